@@ -0,0 +1,139 @@
+
+// Scalar parameter access: value() reads and set_value() writes, which include the access accounting.
+
+#include "synthetic_schema.h"
+
+#include <benchmark/benchmark.h>
+
+
+namespace parameters_benchmarks {
+
+	// Each benchmark thread cycles through its own slice of the parameters, so the threads don't share any parameter
+	// (and its access counters) and the multi-threaded numbers show how well the access paths scale.
+	template <class T>
+	static void assign_slice(benchmark::State &state, const std::vector<T *> &params, size_t &begin, size_t &end) {
+		size_t slice = std::max<size_t>(1, params.size() / state.threads());
+		begin = (size_t(state.thread_index()) * slice) % params.size();
+		end = std::min(params.size(), begin + slice);
+	}
+
+	template <class T>
+	static void read_params(benchmark::State &state, const std::vector<T *> &params) {
+		size_t begin, end;
+		assign_slice(state, params, begin, end);
+		size_t i = begin;
+		for (auto _ : state) {
+			const auto &v = params[i]->value();
+			benchmark::DoNotOptimize(v);
+			if (++i == end)
+				i = begin;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	static void BM_IntParamRead(benchmark::State &state) {
+		read_params(state, GetSyntheticParamSchema().int_params());
+	}
+	BENCHMARK(BM_IntParamRead)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_BoolParamRead(benchmark::State &state) {
+		read_params(state, GetSyntheticParamSchema().bool_params());
+	}
+	BENCHMARK(BM_BoolParamRead)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_DoubleParamRead(benchmark::State &state) {
+		read_params(state, GetSyntheticParamSchema().double_params());
+	}
+	BENCHMARK(BM_DoubleParamRead)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_StringParamRead(benchmark::State &state) {
+		read_params(state, GetSyntheticParamSchema().string_params());
+	}
+	BENCHMARK(BM_StringParamRead)->ThreadRange(1, 8)->UseRealTime();
+
+	// Every write changes the value, so the benchmark covers the full write path, including the change accounting.
+	static void BM_IntParamWrite(benchmark::State &state) {
+		const auto &params = GetSyntheticParamSchema().int_params();
+		size_t begin, end;
+		assign_slice(state, params, begin, end);
+		size_t i = begin;
+		int32_t v = 0;
+		for (auto _ : state) {
+			params[i]->set_value(v++);
+			if (++i == end)
+				i = begin;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_IntParamWrite)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_BoolParamWrite(benchmark::State &state) {
+		const auto &params = GetSyntheticParamSchema().bool_params();
+		size_t begin, end;
+		assign_slice(state, params, begin, end);
+		size_t i = begin;
+		// flip the value on every pass through the slice, so each write is a change.
+		bool v = true;
+		for (auto _ : state) {
+			params[i]->set_value(v);
+			if (++i == end) {
+				i = begin;
+				v = !v;
+			}
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_BoolParamWrite)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_DoubleParamWrite(benchmark::State &state) {
+		const auto &params = GetSyntheticParamSchema().double_params();
+		size_t begin, end;
+		assign_slice(state, params, begin, end);
+		size_t i = begin;
+		double v = 0.0;
+		for (auto _ : state) {
+			params[i]->set_value(v);
+			v += 0.5;
+			if (++i == end)
+				i = begin;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_DoubleParamWrite)->ThreadRange(1, 8)->UseRealTime();
+
+	static void BM_StringParamWrite(benchmark::State &state) {
+		const auto &params = GetSyntheticParamSchema().string_params();
+		size_t begin, end;
+		assign_slice(state, params, begin, end);
+		const std::string values[2] = {"tesseract_word_threshold", "tesseract_char_threshold"};
+		size_t i = begin;
+		size_t pass = 0;
+		for (auto _ : state) {
+			params[i]->set_value(values[pass & 1]);
+			if (++i == end) {
+				i = begin;
+				pass++;
+			}
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_StringParamWrite)->ThreadRange(1, 8)->UseRealTime();
+
+	// Writing through the `const char *` interface, as done by the config file loader and command line parsers.
+	static void BM_IntParamWriteFromString(benchmark::State &state) {
+		const auto &params = GetSyntheticParamSchema().int_params();
+		const char *values[2] = {"42", "-17"};
+		size_t i = 0;
+		size_t pass = 0;
+		for (auto _ : state) {
+			params[i]->set_value(values[pass & 1]);
+			if (++i == params.size()) {
+				i = 0;
+				pass++;
+			}
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_IntParamWriteFromString);
+
+} // namespace
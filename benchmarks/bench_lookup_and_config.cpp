@@ -0,0 +1,112 @@
+
+// Parameter lookup by name and config file loading.
+
+#include "synthetic_schema.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+
+
+namespace parameters_benchmarks {
+
+	// 1 in 10 lookups is for a name which is not in the schema, as happens when a config file carries surplus parameters.
+	static const size_t LOOKUP_SEQUENCE_LENGTH = 4096;
+
+	static void BM_ParamsVectorFind(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		// look in a single vector carrying all parameters.
+		ParamsVector all = schema.set().flattened_copy();
+		const std::vector<std::string> names = schema.lookup_names(LOOKUP_SEQUENCE_LENGTH);
+		size_t i = 0;
+		for (auto _ : state) {
+			ParamPtr p = all.find(names[i].c_str(), ANY_TYPE_PARAM);
+			benchmark::DoNotOptimize(p);
+			if (++i == names.size())
+				i = 0;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_ParamsVectorFind)->RangeMultiplier(10)->Range(10, 10000);
+
+	static void BM_ParamsVectorSetFind(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		const std::vector<std::string> names = schema.lookup_names(LOOKUP_SEQUENCE_LENGTH);
+		size_t i = 0;
+		for (auto _ : state) {
+			ParamPtr p = schema.set().find(names[i].c_str(), ANY_TYPE_PARAM);
+			benchmark::DoNotOptimize(p);
+			if (++i == names.size())
+				i = 0;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_ParamsVectorSetFind)->RangeMultiplier(10)->Range(10, 10000);
+
+	static void BM_ParamsVectorSetFindTyped(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		const std::vector<std::string> names = schema.lookup_names(LOOKUP_SEQUENCE_LENGTH);
+		size_t i = 0;
+		for (auto _ : state) {
+			IntParam *p = schema.set().find<IntParam>(names[i].c_str());
+			benchmark::DoNotOptimize(p);
+			if (++i == names.size())
+				i = 0;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_ParamsVectorSetFindTyped)->RangeMultiplier(10)->Range(10, 10000);
+
+	// The config loaders alternate between two configs which set every parameter to a different value, so every
+	// iteration goes through the full parse, validate and change path for the entire schema.
+
+	static void BM_ReadParamsFileFromString(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		const std::string configs[2] = {schema.config_text(1), schema.config_text(2)};
+		size_t n = 0;
+		for (auto _ : state) {
+			StringConfigReader reader(configs[n++ & 1]);
+			bool rv = ParamUtils::ReadParamsFile(reader, schema.set(), nullptr, PARAM_VALUE_IS_SET_BY_CONFIGFILE);
+			benchmark::DoNotOptimize(rv);
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		state.SetBytesProcessed(state.iterations() * int64_t(configs[0].size() + configs[1].size()) / 2);
+	}
+	BENCHMARK(BM_ReadParamsFileFromString)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+	static std::string write_config_file(const std::string &text, const char *filename) {
+		std::string path = (std::filesystem::temp_directory_path() / filename).string();
+		FILE *f = fopen(path.c_str(), "wb");
+		if (!f)
+			return std::string();
+		bool good = (fwrite(text.data(), 1, text.size(), f) == text.size());
+		if (fclose(f) != 0 || !good)
+			return std::string();
+		return path;
+	}
+
+	static void BM_ReadParamsFileFromStdio(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		const std::string paths[2] = {
+			write_config_file(schema.config_text(1), "libparameters-benchmark-1.config"),
+			write_config_file(schema.config_text(2), "libparameters-benchmark-2.config"),
+		};
+		if (paths[0].empty() || paths[1].empty()) {
+			state.SkipWithError("cannot write the config files to the temp directory");
+			return;
+		}
+		size_t n = 0;
+		for (auto _ : state) {
+			StdioConfigReader reader(paths[n++ & 1]);
+			bool rv = ParamUtils::ReadParamsFile(reader, schema.set(), nullptr, PARAM_VALUE_IS_SET_BY_CONFIGFILE);
+			benchmark::DoNotOptimize(rv);
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+		for (const std::string &path : paths) {
+			std::remove(path.c_str());
+		}
+	}
+	BENCHMARK(BM_ReadParamsFileFromStdio)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,36 @@
+
+// Benchmark suite for the library's hot paths.
+//
+// The parameter schemas used by these benchmarks are generated deterministically (see synthetic_schema.h), so runs are comparable
+// across builds. To make a regression visible, record a baseline and compare against it, e.g.:
+//
+//     parameters_benchmarks --benchmark_repetitions=10 --benchmark_report_aggregates_only=true \
+//             --benchmark_out_format=json --benchmark_out=baseline.json
+//     ... rebuild ...
+//     parameters_benchmarks --benchmark_repetitions=10 --benchmark_report_aggregates_only=true \
+//             --benchmark_out_format=json --benchmark_out=contender.json
+//     compare.py benchmarks baseline.json contender.json
+//
+// where compare.py is the script which ships with Google Benchmark (tools/compare.py). Pin the process to a single core and
+// disable CPU frequency scaling for the most stable numbers.
+
+#include <parameters/parameters.h>
+
+#include <cstdio>
+
+#include <benchmark/benchmark.h>
+
+#if defined(BUILD_MONOLITHIC)
+#define main	parameters_benchmarks_main
+#endif
+
+int main(int argc, const char** argv) {
+	printf("Running main() from %s\n", __FILE__);
+	char **args = const_cast<char **>(argv);
+	benchmark::Initialize(&argc, args);
+	if (benchmark::ReportUnrecognizedArguments(argc, args))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
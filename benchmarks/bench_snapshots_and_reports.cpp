@@ -0,0 +1,71 @@
+
+// Snapshots (take / rewind) and the usage statistics report.
+
+#include "synthetic_schema.h"
+
+#include <benchmark/benchmark.h>
+
+
+namespace parameters_benchmarks {
+
+	// Take a snapshot of the tesseract-sized schema, change `range(0)` parameters and rewind to the snapshot.
+	static void BM_SnapshotTakeAndRewind(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema();
+		const auto &params = schema.int_params();
+		const size_t change_count = std::min(params.size(), size_t(state.range(0)));
+		SnapshotSeries series;
+		int32_t v = 0;
+		for (auto _ : state) {
+			Snapshot &snapshot = series.TakeSnapshot("benchmark", &schema.set(), nullptr);
+			for (size_t i = 0; i < change_count; i++) {
+				params[i]->set_value(v++);
+			}
+			series.RewindToSnapshot(snapshot);
+			series.PopSnapshot();
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SnapshotTakeAndRewind)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+	// Nested snapshots are delta snapshots: only the parameters changed since the base snapshot are recorded.
+	static void BM_DeltaSnapshotTakeAndRewind(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema();
+		const auto &params = schema.int_params();
+		const size_t change_count = std::min(params.size(), size_t(state.range(0)));
+		SnapshotSeries series;
+		series.TakeSnapshot("base", &schema.set(), nullptr);
+		int32_t v = 0;
+		for (auto _ : state) {
+			Snapshot &snapshot = series.TakeSnapshot("benchmark", &schema.set(), nullptr);
+			for (size_t i = 0; i < change_count; i++) {
+				params[i]->set_value(v++);
+			}
+			series.RewindToSnapshot(snapshot);
+			series.PopSnapshot();
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_DeltaSnapshotTakeAndRewind)->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+	// The report resets the access counters, so each iteration first reads a fixed subset of the parameters to produce
+	// the same report every time.
+	static void BM_ReportParamsUsageStatistics(benchmark::State &state) {
+		SyntheticParamSchema &schema = GetSyntheticParamSchema(size_t(state.range(0)));
+		const auto &params = schema.int_params();
+		for (auto _ : state) {
+			state.PauseTiming();
+			for (size_t i = 0; i < params.size(); i += 3) {
+				int32_t v = params[i]->value();
+				benchmark::DoNotOptimize(v);
+			}
+			state.ResumeTiming();
+
+			StringReportWriter writer;
+			ParamUtils::ReportParamsUsageStatistics(writer, schema.set(), 0, true);
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+	BENCHMARK(BM_ReportParamsUsageStatistics)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,68 @@
+
+// Vector parameters: parsing a value string and formatting the value.
+
+#include "synthetic_schema.h"
+
+#include <benchmark/benchmark.h>
+
+
+namespace parameters_benchmarks {
+
+	template <class VecParam>
+	static void parse_vector_param(benchmark::State &state, ParamType element_type) {
+		ParamsVector owner("vector benchmark");
+		VecParam p("", "benchmark_vector", "vector parameter parse benchmark", owner);
+		// alternate between two values, so every parse produces a change.
+		const std::string values[2] = {
+			SyntheticVectorValue(element_type, size_t(state.range(0)), 1),
+			SyntheticVectorValue(element_type, size_t(state.range(0)), 2),
+		};
+		size_t n = 0;
+		for (auto _ : state) {
+			p.set_value(values[n++ & 1].c_str());
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	template <class VecParam>
+	static void format_vector_param(benchmark::State &state, ParamType element_type) {
+		ParamsVector owner("vector benchmark");
+		VecParam p(SyntheticVectorValue(element_type, size_t(state.range(0))).c_str(), "benchmark_vector", "vector parameter format benchmark", owner);
+		for (auto _ : state) {
+			std::string s = p.formatted_value_str();
+			benchmark::DoNotOptimize(s);
+		}
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	static void BM_IntVectorParamParse(benchmark::State &state) {
+		parse_vector_param<IntSetParam>(state, INT_PARAM);
+	}
+	BENCHMARK(BM_IntVectorParamParse)->RangeMultiplier(4)->Range(4, 1024);
+
+	static void BM_DoubleVectorParamParse(benchmark::State &state) {
+		parse_vector_param<DoubleSetParam>(state, DOUBLE_PARAM);
+	}
+	BENCHMARK(BM_DoubleVectorParamParse)->RangeMultiplier(4)->Range(4, 1024);
+
+	static void BM_StringVectorParamParse(benchmark::State &state) {
+		parse_vector_param<StringSetParam>(state, STRING_PARAM);
+	}
+	BENCHMARK(BM_StringVectorParamParse)->RangeMultiplier(4)->Range(4, 1024);
+
+	static void BM_IntVectorParamFormat(benchmark::State &state) {
+		format_vector_param<IntSetParam>(state, INT_PARAM);
+	}
+	BENCHMARK(BM_IntVectorParamFormat)->RangeMultiplier(4)->Range(4, 1024);
+
+	static void BM_DoubleVectorParamFormat(benchmark::State &state) {
+		format_vector_param<DoubleSetParam>(state, DOUBLE_PARAM);
+	}
+	BENCHMARK(BM_DoubleVectorParamFormat)->RangeMultiplier(4)->Range(4, 1024);
+
+	static void BM_StringVectorParamFormat(benchmark::State &state) {
+		format_vector_param<StringSetParam>(state, STRING_PARAM);
+	}
+	BENCHMARK(BM_StringVectorParamFormat)->RangeMultiplier(4)->Range(4, 1024);
+
+} // namespace
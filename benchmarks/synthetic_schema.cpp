@@ -0,0 +1,170 @@
+
+#include "synthetic_schema.h"
+
+#include <fmt/format.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_set>
+
+
+namespace parameters_benchmarks {
+
+	// name fragments modeled after the tesseract parameter names, e.g. `textord_min_xheight` or `classify_norm_adj_midpoint`.
+	static const char *schema_prefixes[] = {
+		"textord_", "classify_", "tessedit_", "language_model_", "wordrec_", "segsearch_", "chop_", "edges_",
+		"stopper_", "dawg_", "lstm_", "pageseg_", "crunch_", "quality_", "thresholding_", "debug_",
+	};
+	static const char *schema_words[] = {
+		"min", "max", "xheight", "norm", "adj", "midpoint", "blob", "size", "ratio", "penalty", "threshold", "weight",
+		"enable", "use", "pass", "word", "char", "noise", "limit", "margin", "overlap", "spacing", "baseline", "certainty",
+		"rating", "mode", "level", "file", "scale", "fraction",
+	};
+
+	template <class T, size_t N>
+	static const T &pick(std::mt19937_64 &rng, const T (&list)[N]) {
+		return list[rng() % N];
+	}
+
+	SyntheticParamSchema::SyntheticParamSchema(size_t param_count, size_t vector_count, uint64_t seed) {
+		std::mt19937_64 rng(seed);
+
+		if (vector_count == 0)
+			vector_count = 1;
+		for (size_t i = 0; i < vector_count; i++) {
+			vectors_.push_back(std::make_unique<ParamsVector>(i == 0 ? "global" : "component"));
+			// the vectors destroy the parameters we create below.
+			vectors_.back()->mark_as_all_params_owner();
+			set_.add(vectors_.back().get());
+		}
+
+		std::unordered_set<std::string> seen;
+		names_.reserve(param_count);
+		types_.reserve(param_count);
+		for (size_t i = 0; i < param_count; i++) {
+			std::string name = fmt::format("{}{}_{}", pick(rng, schema_prefixes), pick(rng, schema_words), pick(rng, schema_words));
+			if (!seen.insert(name).second) {
+				name += fmt::format("_{}", i);
+				seen.insert(name);
+			}
+
+			// the global vector carries about half of the parameters.
+			ParamsVector &owner = *vectors_[(rng() % 2 == 0) ? 0 : rng() % vector_count];
+
+			// a tesseract-like type mix.
+			unsigned int kind = unsigned(rng() % 100);
+			ParamType type;
+			if (kind < 38) {
+				type = INT_PARAM;
+				int_params_.push_back(new IntParam(int32_t(rng() % 2001) - 1000, name.c_str(), "synthetic int parameter", owner));
+			} else if (kind < 72) {
+				type = BOOL_PARAM;
+				bool_params_.push_back(new BoolParam(rng() % 2 == 0, name.c_str(), "synthetic bool parameter", owner));
+			} else if (kind < 87) {
+				type = DOUBLE_PARAM;
+				double_params_.push_back(new DoubleParam(double(rng() % 100000) / 1000.0, name.c_str(), "synthetic double parameter", owner));
+			} else if (kind < 97) {
+				type = STRING_PARAM;
+				string_params_.push_back(new StringParam(std::string(pick(rng, schema_words)), name.c_str(), "synthetic string parameter", owner));
+			} else if (kind < 98) {
+				type = INT_SET_PARAM;
+				new IntSetParam(SyntheticVectorValue(INT_PARAM, 4 + rng() % 12, rng()).c_str(), name.c_str(), "synthetic int vector parameter", owner);
+			} else if (kind < 99) {
+				type = DOUBLE_SET_PARAM;
+				new DoubleSetParam(SyntheticVectorValue(DOUBLE_PARAM, 4 + rng() % 12, rng()).c_str(), name.c_str(), "synthetic double vector parameter", owner);
+			} else {
+				type = STRING_SET_PARAM;
+				new StringSetParam(SyntheticVectorValue(STRING_PARAM, 2 + rng() % 6, rng()).c_str(), name.c_str(), "synthetic string vector parameter", owner);
+			}
+			names_.push_back(std::move(name));
+			types_.push_back(type);
+		}
+	}
+
+	SyntheticParamSchema::~SyntheticParamSchema() = default;
+
+	std::string SyntheticParamSchema::config_text(uint64_t seed) const {
+		std::mt19937_64 rng(seed);
+		std::string text;
+		text.reserve(names_.size() * 48);
+		for (size_t i = 0; i < names_.size(); i++) {
+			text += names_[i];
+			text += '\t';
+			switch (types_[i]) {
+			case INT_PARAM:
+				text += fmt::format("{}", int32_t(rng() % 2001) - 1000);
+				break;
+
+			case BOOL_PARAM:
+				text += (rng() % 2 == 0 ? "T" : "F");
+				break;
+
+			case DOUBLE_PARAM:
+				text += fmt::format("{}", double(rng() % 100000) / 1000.0);
+				break;
+
+			case STRING_PARAM:
+				text += pick(rng, schema_words);
+				break;
+
+			default:
+				text += SyntheticVectorValue(ParamType(types_[i] & ~VECTOR_PARAM), 4 + rng() % 12, rng());
+				break;
+			}
+			text += '\n';
+		}
+		return text;
+	}
+
+	std::vector<std::string> SyntheticParamSchema::lookup_names(size_t count, unsigned int miss_percentage, uint64_t seed) const {
+		std::mt19937_64 rng(seed);
+		std::vector<std::string> rv;
+		rv.reserve(count);
+		for (size_t i = 0; i < count; i++) {
+			if (names_.empty() || rng() % 100 < miss_percentage)
+				rv.push_back(fmt::format("no_such_{}_{}", pick(rng, schema_words), i));
+			else
+				rv.push_back(names_[rng() % names_.size()]);
+		}
+		return rv;
+	}
+
+	SyntheticParamSchema &GetSyntheticParamSchema(size_t param_count) {
+		static std::mutex lock;
+		static std::map<size_t, std::unique_ptr<SyntheticParamSchema>> schemas;
+
+		std::lock_guard<std::mutex> guard(lock);
+		auto &schema = schemas[param_count];
+		if (!schema)
+			schema = std::make_unique<SyntheticParamSchema>(param_count);
+		return *schema;
+	}
+
+	std::string SyntheticVectorValue(ParamType element_type, size_t count, uint64_t seed) {
+		std::mt19937_64 rng(seed);
+		std::string text;
+		for (size_t i = 0; i < count; i++) {
+			if (i > 0)
+				text += ',';
+			switch (element_type) {
+			case INT_PARAM:
+				text += fmt::format("{}", int32_t(rng() % 2001) - 1000);
+				break;
+
+			case BOOL_PARAM:
+				text += (rng() % 2 == 0 ? "1" : "0");
+				break;
+
+			case DOUBLE_PARAM:
+				text += fmt::format("{}", double(rng() % 100000) / 1000.0);
+				break;
+
+			default:
+				text += pick(rng, schema_words);
+				break;
+			}
+		}
+		return text;
+	}
+
+} // namespace
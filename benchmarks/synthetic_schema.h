@@ -0,0 +1,95 @@
+
+// A synthetic, tesseract-sized parameter schema generator, used to feed the benchmarks.
+//
+// The schema is fully determined by the `seed` and `param_count` arguments: the generator uses std::mt19937_64, whose output sequence
+// is defined by the C++ standard, and no implementation-defined distributions, so every platform and run produces the exact same
+// names, types, defaults and config file. This keeps benchmark results comparable across runs and builds.
+
+#ifndef _LIB_PARAMS_BENCHMARKS_SYNTHETIC_SCHEMA_H_
+#define _LIB_PARAMS_BENCHMARKS_SYNTHETIC_SCHEMA_H_
+
+#include <parameters/parameters.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace parameters_benchmarks {
+
+	using namespace parameters;
+
+	// tesseract (v5) carries roughly this many parameters.
+	static const size_t TESSERACT_SIZED_PARAM_COUNT = 900;
+
+	class SyntheticParamSchema {
+	public:
+		// Generate `param_count` parameters, spread across `vector_count` ParamsVector instances (think: one global vector plus
+		// a few per-component ones), with a tesseract-like mix of types: mostly int and bool, fewer double and string parameters
+		// and a handful of vector parameters.
+		SyntheticParamSchema(size_t param_count = TESSERACT_SIZED_PARAM_COUNT, size_t vector_count = 4, uint64_t seed = 0x7e55e7ac7);
+		~SyntheticParamSchema();
+
+		SyntheticParamSchema(const SyntheticParamSchema &o) = delete;
+		SyntheticParamSchema &operator=(const SyntheticParamSchema &other) = delete;
+
+		ParamsVectorSet &set() noexcept {
+			return set_;
+		}
+		ParamsVector &vector(size_t index) noexcept {
+			return *vectors_[index];
+		}
+		size_t vector_count() const noexcept {
+			return vectors_.size();
+		}
+
+		// All parameter names, in order of generation.
+		const std::vector<std::string> &names() const noexcept {
+			return names_;
+		}
+
+		// The scalar parameters, by type, in order of generation.
+		const std::vector<IntParam *> &int_params() const noexcept {
+			return int_params_;
+		}
+		const std::vector<BoolParam *> &bool_params() const noexcept {
+			return bool_params_;
+		}
+		const std::vector<DoubleParam *> &double_params() const noexcept {
+			return double_params_;
+		}
+		const std::vector<StringParam *> &string_params() const noexcept {
+			return string_params_;
+		}
+
+		// A config file which sets every parameter in the schema to a (different, but valid) value, in the format accepted by
+		// ParamUtils::ReadParamsFile(). Each call with the same `seed` produces the same text.
+		std::string config_text(uint64_t seed = 1) const;
+
+		// A deterministic sequence of lookup names: `count` names picked from the schema, interspersed with a `miss_percentage`
+		// of names which are not part of it.
+		std::vector<std::string> lookup_names(size_t count, unsigned int miss_percentage = 10, uint64_t seed = 2) const;
+
+	protected:
+		std::vector<std::unique_ptr<ParamsVector>> vectors_;
+		ParamsVectorSet set_;
+		std::vector<std::string> names_;
+		std::vector<ParamType> types_;
+
+		std::vector<IntParam *> int_params_;
+		std::vector<BoolParam *> bool_params_;
+		std::vector<DoubleParam *> double_params_;
+		std::vector<StringParam *> string_params_;
+	};
+
+	// Produce a (cached) schema of the given size, shared by all benchmarks in the process; the schema is constructed on first use.
+	SyntheticParamSchema &GetSyntheticParamSchema(size_t param_count = TESSERACT_SIZED_PARAM_COUNT);
+
+	// A deterministic vector parameter value in the config/parse format: `count` elements, comma separated.
+	std::string SyntheticVectorValue(ParamType element_type, size_t count, uint64_t seed = 3);
+
+} // namespace
+
+#endif
@@ -19,12 +19,16 @@
 #include <string>
 #include <ctype.h>
 #include <stdexcept>
+#include <utility>
 
 namespace parameters {
 
 	template <size_t SMALL_STRING_ALLOCSIZE = 16>
 	class CString {
 	public:
+		// makes CString usable with std::back_inserter() et al, e.g. for fmt::format_to().
+		typedef char value_type;
+
 		CString() noexcept:
 			_buffer(_small_buffer),
 			_allocsize(SMALL_STRING_ALLOCSIZE),
@@ -397,6 +401,23 @@ namespace parameters {
 			append((const char *)data_ptr, size);
 		}
 
+		void append(char c) {
+			push_back(c);
+		}
+
+		// Append a single character. The buffer grows exponentially, so appending character by character,
+		// as done by std::back_inserter(), costs amortized O(1) per character.
+		void push_back(char c) {
+			size_t dlen = length();
+			if (datasize() - dlen < 2) {
+				resize(_allocsize * 2 + 2);
+			}
+			char *d = data() + dlen;
+			d[0] = c;
+			d[1] = 0;
+			_contentsize++;
+		}
+
 		// same as clear() + append(): rewinds the CString buffer to the start and appends the given data.
 		void assign(const char *data_ptr, size_t size) {
 			clear();
@@ -418,6 +439,27 @@ namespace parameters {
 			append(data.c_str());
 		}
 
+		// Exchange the content of two strings. Heap allocated buffers are exchanged as-is, i.e. no content is copied
+		// unless it lives in the small string buffer.
+		void swap(CString &other) noexcept {
+			if (this == &other)
+				return;
+			bool this_is_small = (_buffer == _small_buffer);
+			bool other_is_small = (other._buffer == other._small_buffer);
+			char tmp[SMALL_STRING_ALLOCSIZE];
+			memcpy(tmp, _small_buffer, sizeof(tmp));
+			memcpy(_small_buffer, other._small_buffer, sizeof(tmp));
+			memcpy(other._small_buffer, tmp, sizeof(tmp));
+			std::swap(_buffer, other._buffer);
+			if (this_is_small)
+				other._buffer = other._small_buffer;
+			if (other_is_small)
+				_buffer = _small_buffer;
+			std::swap(_allocsize, other._allocsize);
+			std::swap(_str_start_offset, other._str_start_offset);
+			std::swap(_contentsize, other._contentsize);
+		}
+
 	protected:
 		char _small_buffer[SMALL_STRING_ALLOCSIZE];
 		size_t _allocsize;
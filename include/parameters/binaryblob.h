@@ -0,0 +1,88 @@
+/*
+ * Class definitions of the *_VAR classes for tunable constants.
+ *
+ * UTF8 detect helper statement: «bloody MSVC»
+*/
+
+#ifndef _LIB_PARAMS_BINARYBLOB_H_
+#define _LIB_PARAMS_BINARYBLOB_H_
+
+#include <parameters/parameter_class_fundamentals.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+namespace parameters {
+
+	// --------------------------------------------------------------------------------------------------
+
+	// BinaryBlobFile, et al, used as support class for loading large numeric array parameters (IntSetParam, DoubleSetParam)
+	// straight from a binary file instead of parsing a (potentially multi-megabyte) text value.
+	//
+	// A config file line references such a file by prefixing the path with a '@', e.g.
+	//
+	//     weights    @/path/to/weights.f64
+	//
+	// The array data is read straight into the parameter's value vector using a single bulk read: no text parsing takes place.
+	//
+	// File layout: a 24 byte header (see below), followed by `element_count` raw little-endian values of `element_size` bytes each.
+
+	struct BinaryBlobHeader {
+		char magic[4];               // "PBLB"
+		uint16_t version;            // format version; currently 1.
+		uint16_t element_type;       // ParamType: INT_PARAM (int32_t) or DOUBLE_PARAM (IEEE754 double)
+		uint32_t element_size;       // sizeof() a single element: 4 for INT_PARAM, 8 for DOUBLE_PARAM
+		uint32_t reserved;           // must be zero
+		uint64_t element_count;
+	};
+	static_assert(sizeof(BinaryBlobHeader) == 24);
+
+	// A binary blob file, opened for reading.
+	class BinaryBlobFile {
+	public:
+		// Open the given file and validate its header.
+		//
+		// Use `operator bool()` to check whether the file was opened and validated successfully;
+		// `error_message()` produces a human readable description of the problem when it wasn't.
+		BinaryBlobFile(const char *path);
+		BinaryBlobFile(const std::string &path);
+		~BinaryBlobFile();
+
+		BinaryBlobFile(const BinaryBlobFile &o) = delete;
+		BinaryBlobFile &operator=(const BinaryBlobFile &other) = delete;
+
+		operator bool() const {
+			return _file != nullptr;
+		};
+
+		const std::string &error_message() const;
+
+		ParamType element_type() const;
+		size_t element_count() const;
+
+		// Fill `dst` with the array content. Returns false (and leaves `dst` untouched) when the blob's element type does not match
+		// or the array data cannot be read.
+		bool get(std::vector<int32_t> &dst) const;
+		bool get(std::vector<double> &dst) const;
+
+		// Write a binary blob file, which can be loaded by this class afterwards. Returns false on (I/O) error.
+		static bool Write(const char *path, const std::vector<int32_t> &src);
+		static bool Write(const char *path, const std::vector<double> &src);
+
+	private:
+		void open(const char *path);
+		void close();
+
+	private:
+		FILE *_file;                // NULL on error
+		BinaryBlobHeader _header;
+		std::string _path;
+		std::string _errmsg;
+	};
+
+} // namespace
+
+#endif
@@ -9,10 +9,12 @@
 
 #include <parameters/parameter_class_fundamentals.h>
 #include <parameters/fmt-support.h>
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <vector>
 #include <functional>
+#include <chrono>
 
 
 namespace parameters {
@@ -21,8 +23,16 @@ namespace parameters {
 
 	// --------------------------------------------------------------------------------------------------
 
+	class SnapshotValues;
+	class SnapshotSeries;
+	class SharedStatsExport;
+
 	// Definition of various parameter types.
 	class Param {
+		friend class SnapshotValues;
+		friend class SnapshotSeries;
+		friend class ParamsVector;
+
 	protected:
 		Param(const char *name, const char *comment, ParamsVector &owner, bool init = false);
 
@@ -63,6 +73,15 @@ namespace parameters {
 
 		ParamsVector &owner() const noexcept;
 
+		// Every actual value change stamps the parameter with a new write version: these version numbers are drawn from a single,
+		// library-wide, monotonically increasing counter, so they can be compared across parameters as well.
+		// Snapshots use this to find out which parameters have changed since a given point in time: any parameter
+		// with `version() > stamp`, where `stamp` was obtained via current_version() at that point, has been changed since.
+		uint64_t version() const noexcept;
+
+		// Produce the most recently issued write version.
+		static uint64_t current_version() noexcept;
+
 		// We track Param/Variable setup/changes/usage through this administrative struct.
 		// It helps us to diagnose and report which tesseract Params (Variables) are actually
 		// USED in which program section and in the program as a whole, while we can also 
@@ -70,14 +89,91 @@ namespace parameters {
 		// some Params will have been modified due to others having been set, e.g. `debug_all`.
 		typedef struct access_counts {
 			// the current section's counts
-			uint16_t reading;
-			uint16_t writing;   // counting the number of *write* actions, answering the question "did we assign a value to this one during this run?"
-			uint16_t changing;  // counting the number of times a *write* action resulted in an actual *value change*, answering the question "did we use a non-default value for this one during this run?"
-			uint16_t faulting;  // counting the number of times a *parse* action produced a *fault* instead of a legal value to be written into the parameter.
+			uint32_t reading;
+			uint32_t writing;   // counting the number of *write* actions, answering the question "did we assign a value to this one during this run?"
+			uint32_t changing;  // counting the number of times a *write* action resulted in an actual *value change*, answering the question "did we use a non-default value for this one during this run?"
+			uint32_t faulting;  // counting the number of times a *parse* action produced a *fault* instead of a legal value to be written into the parameter.
+
+			// the sums of the counts of all previous sections, i.e. the totals up to the last reset_access_counts().
+			// Only updated by reset_access_counts(), so the access paths only ever touch the (narrower) section counters above.
+			uint64_t prev_sum_reading;
+			uint64_t prev_sum_writing;
+			uint64_t prev_sum_changing;
+			uint64_t prev_sum_faulting;
 		} access_counts_t;
 
 		const access_counts_t &access_counts() const noexcept;
 
+		// Optional access timestamps, in nanoseconds since application start as measured by a cheap, coarse monotonic clock
+		// (see ParamUtils::AccessClockNow()). Zero means the event has not occurred (yet).
+		//
+		// The clock is only consulted on counter transitions, never on every read: `last_read` is refreshed by the first read in
+		// each section and whenever the section's read count reaches the next power of two, so it is approximate for heavily
+		// read parameters. Value changes are rare, so `last_change` is exact.
+		typedef struct access_times {
+			uint64_t first_read;
+			uint64_t last_read;
+			uint64_t last_change;
+		} access_times_t;
+
+		// Start (or stop) recording the access timestamps of this parameter. Unlike the access counts, these are not
+		// affected by reset_access_counts(): they cover the entire run.
+		void track_access_times(bool enable = true);
+
+		// Produce the recorded access timestamps, or NULL when these are not being tracked for this parameter.
+		const access_times_t *access_times() const noexcept;
+
+		// The user-definable event handlers, as installed via the set_on_*_handler() APIs of the derived classes.
+		enum HandlerKind {
+			ON_PARSE_HANDLER = 0,
+			ON_VALIDATE_HANDLER,
+			ON_MODIFY_HANDLER,
+			ON_FORMAT_HANDLER,
+
+			HANDLER_KIND_COUNT
+		};
+
+		// Optional handler timing statistics, per handler kind; latencies are measured by std::chrono::steady_clock.
+		typedef struct handler_timing {
+			uint64_t calls;
+			uint64_t total_ns;
+			uint64_t max_ns;
+		} handler_timing_t;
+		typedef struct handler_timings {
+			handler_timing_t handler[HANDLER_KIND_COUNT];
+		} handler_timings_t;
+
+		// Start (or stop) timing the event handler invocations of this parameter. Not affected by reset_access_counts().
+		void track_handler_timings(bool enable = true);
+
+		// Produce the recorded handler timings, or NULL when these are not being tracked for this parameter.
+		const handler_timings_t *handler_timings() const noexcept;
+
+		static const char *handler_kind_str(HandlerKind kind) noexcept;
+
+#if PARAMETERS_TRACK_CALL_SITES
+		// A code location which wrote or read this parameter; see call_sites().
+		typedef struct call_site {
+			const char *file;           // std::source_location::file_name()
+			const char *function;       // std::source_location::function_name()
+			uint32_t line;
+			uint64_t writes;            // every write attempt is counted
+			uint64_t sampled_reads;     // only sampled reads are counted; see set_call_site_read_sampling()
+		} call_site_t;
+
+		// The code locations which wrote or read this parameter, in order of first appearance. Not affected by reset_access_counts().
+		//
+		// Accesses through the conversion and assignment operators are attributed to the operator in the library itself, as C++ offers
+		// no way to pass the caller's location into those: use value() and set_value() where accurate attribution matters.
+		const std::vector<call_site_t> &call_sites() const noexcept;
+		void clear_call_sites() noexcept;
+
+		// Sample one in every `interval` reads in a section (rounded up to a power of two), starting with the first read in the section.
+		// 1 records every read; the default is 64.
+		static void set_call_site_read_sampling(uint32_t interval) noexcept;
+		static uint32_t call_site_read_sampling() noexcept;
+#endif
+
 		// Reset the access count statistics in preparation for the next run.
 		// As a side effect the current run's access count statistics will be added to the history
 		// set, available via the `prev_sum_*` access_counts_t members.
@@ -168,6 +264,66 @@ namespace parameters {
 
 		ParamType type() const noexcept;
 
+	protected:
+		// To be invoked by the derived classes' set_value() et al implementations when a write is about to actually *change*
+		// the parameter value, i.e. *before* the new value is stored.
+		void note_value_change() noexcept;
+
+		// Bump one of the section access counters (saturating increment: no wrap-around).
+		// The first access in a section registers the parameter in the dirty set of its owner (see ParamsVector::touched_list()).
+		// When access timestamps are tracked, the clock is sampled each time the counter reaches a power of two.
+		void count_access(uint32_t &counter) const {
+			if (!touched_.load(std::memory_order_relaxed))
+				note_first_access();
+			if (++counter == 0)
+				counter--;
+			else if (access_times_ != nullptr && (counter & (counter - 1)) == 0)
+				note_access_time(counter);
+		}
+
+		// Count a read resp. write access, attributed to the given call site when call-site tracking has been compiled in.
+		void count_read(PARAM_CALL_SITE_ONLY_PARAM) const {
+			count_access(access_counts_.reading);
+#if PARAMETERS_TRACK_CALL_SITES
+			if (((access_counts_.reading - 1) & call_site_read_sample_mask_) == 0)
+				note_call_site(call_site, false);
+#endif
+		}
+		void count_write(PARAM_CALL_SITE_ONLY_PARAM) {
+			count_access(access_counts_.writing);
+#if PARAMETERS_TRACK_CALL_SITES
+			note_call_site(call_site, true);
+#endif
+		}
+
+		// Invoke one of the event handlers, timing the call when handler timings are tracked for this parameter.
+		template <class F, class... Args>
+		auto call_handler(HandlerKind kind, F &handler, Args &&...args) const {
+			if (handler_timings_ == nullptr)
+				return handler(std::forward<Args>(args)...);
+
+			// record the latency on the way out, also when the handler throws.
+			struct timed_call {
+				handler_timing_t &timing;
+				std::chrono::steady_clock::time_point start;
+
+				~timed_call() {
+					uint64_t ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+					timing.calls++;
+					timing.total_ns += ns;
+					if (ns > timing.max_ns)
+						timing.max_ns = ns;
+				}
+			} guard{handler_timings_->handler[kind], std::chrono::steady_clock::now()};
+			return handler(std::forward<Args>(args)...);
+		}
+
+		void note_first_access() const noexcept;
+		void note_access_time(const uint32_t &counter) const;
+#if PARAMETERS_TRACK_CALL_SITES
+		void note_call_site(const std::source_location &call_site, bool write) const;
+#endif
+
 	protected:
 		const char *name_; // name of this parameter
 		const char *info_; // for menus
@@ -180,6 +336,27 @@ namespace parameters {
 		ParamValueContainer default_;
 #endif
 		mutable access_counts_t access_counts_;
+		// NULL unless access timestamps are tracked; see track_access_times().
+		access_times_t *access_times_;
+		// NULL unless handler timings are tracked; see track_handler_timings().
+		handler_timings_t *handler_timings_;
+#if PARAMETERS_TRACK_CALL_SITES
+		mutable std::vector<call_site_t> call_sites_;
+		static uint32_t call_site_read_sample_mask_;
+#endif
+
+		uint64_t version_;
+		// shared by all threads writing any parameter, hence atomic: a lost increment could hand out duplicate (or stale) versions.
+		static std::atomic<uint64_t> last_issued_version_;
+
+		// the snapshot series which currently journals parameter changes (if any).
+		static SnapshotSeries *active_journal_;
+
+		// registered in the owner's dirty set, i.e. accessed since the last section reset. The first accesses by multiple threads
+		// may race to set this flag: only the thread which flips it gets to register the parameter.
+		mutable std::atomic<bool> touched_;
+		// the next parameter in the owner's dirty set, which is an intrusive, lock-free singly linked list (see ParamsVector::touched_list()).
+		mutable Param *next_touched_;
 
 		ParamType type_ : 13;
 
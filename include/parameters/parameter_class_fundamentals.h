@@ -13,6 +13,32 @@
 #include <vector>
 #include <functional>
 
+// Call-site attribution of parameter writes and (sampled) reads, see Param::call_sites().
+//
+// This adds a std::source_location argument to every set_value() and value() call, hence it is opt-in and compiled out entirely by
+// default. When enabled, both the library and the application code must be compiled with the same PARAMETERS_TRACK_CALL_SITES setting.
+#ifndef PARAMETERS_TRACK_CALL_SITES
+#define PARAMETERS_TRACK_CALL_SITES 0
+#endif
+
+#if PARAMETERS_TRACK_CALL_SITES
+#include <source_location>
+
+#define PARAM_CALL_SITE_PARAM           , const std::source_location &call_site
+#define PARAM_CALL_SITE_PARAM_TYPE      , const std::source_location &
+#define PARAM_CALL_SITE_ONLY_PARAM      const std::source_location &call_site
+#define PARAM_CALL_SITE_ONLY_PARAM_TYPE const std::source_location &
+#define PARAM_CALL_SITE_ARG             , call_site
+#define PARAM_CALL_SITE_ONLY_ARG        call_site
+#else
+#define PARAM_CALL_SITE_PARAM
+#define PARAM_CALL_SITE_PARAM_TYPE
+#define PARAM_CALL_SITE_ONLY_PARAM
+#define PARAM_CALL_SITE_ONLY_PARAM_TYPE
+#define PARAM_CALL_SITE_ARG
+#define PARAM_CALL_SITE_ONLY_ARG
+#endif
+
 
 namespace parameters {
 
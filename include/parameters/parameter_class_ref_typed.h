@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <utility>
 
 
 namespace parameters {
@@ -81,6 +82,7 @@ namespace parameters {
 		operator const T *() const noexcept;
 		//void operator=(T value);
 		void operator=(const T &value);
+		void operator=(T &&value);
 		void operator=(const T *value);
 
 		const T& operator () (void) const noexcept;
@@ -98,6 +100,18 @@ namespace parameters {
 
 		virtual void set_value(const char *v, SOURCE_REF) override;
 		void set_value(const T &v, SOURCE_REF);
+		// Move the incoming value through the validate and modify handlers into the parameter storage: no copies are made.
+		void set_value(T &&v, SOURCE_REF);
+
+		// Construct a new value from the given arguments and write it into the parameter, i.e. the moral equivalent of
+		// `set_value(T(args...))`.
+		//
+		// As the validate and modify handlers must be able to inspect both the old and the new value, the new value cannot
+		// be constructed in the parameter storage itself; it is constructed once and then *moved* all the way into storage.
+		template <class... Args>
+		void emplace(Args &&...args) {
+			set_value(T(std::forward<Args>(args)...));
+		}
 
 		// the Param::set_value methods will not be considered by the compiler here, resulting in at least 1 compile error in params.cpp,
 		// due to this nasty little blurb:
@@ -123,7 +137,7 @@ namespace parameters {
 		// reckoned it'd bother all four of them: IntParam, FloatParam, etc.
 		using Param::set_value;
 
-		const T &value() const noexcept;
+		const T &value(CALL_SITE_REF_ONLY) const noexcept;
 
 		// Optionally the `source_vec` can be used to source the value to reset the parameter to.
 		// When no source vector is specified, or when the source vector does not specify this
@@ -165,6 +179,54 @@ namespace parameters {
 
 	// --------------------------------------------------------------------------------------------------
 
+	// As RefTypedParam is meant to be instantiated for user-defined types, the write path is provided here,
+	// rather than as explicit specializations in the library.
+
+	template <class T, class Assistant>
+	void RefTypedParam<T, Assistant>::set_value(const T &val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		// copy once, then take the move path.
+		set_value(T(val), source_type, source PARAM_CALL_SITE_ARG);
+	}
+
+	template <class T, class Assistant>
+	void RefTypedParam<T, Assistant>::set_value(T &&val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
+
+		T value(std::move(val));
+		reset_fault();
+		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
+		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
+		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
+		if (!has_faulted()) {
+			set_ = (source_type > PARAM_VALUE_IS_RESET);
+			set_to_non_default_value_ = (value != default_);
+
+			if (value != value_) {
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
+				if (!has_faulted() && value != value_) {
+					note_value_change();
+					count_access(access_counts_.changing);
+					value_ = std::move(value);
+				}
+			}
+		}
+		// any signaled fault will be visible outside...
+	}
+
+	template <class T, class Assistant>
+	void RefTypedParam<T, Assistant>::operator=(const T &value) {
+		set_value(value);
+	}
+
+	template <class T, class Assistant>
+	void RefTypedParam<T, Assistant>::operator=(T &&value) {
+		set_value(std::move(value));
+	}
+
+	// --------------------------------------------------------------------------------------------------
+
 	// remove the macros to help set up the member prototypes
 
 #include <parameters/sourceref_defend.h>
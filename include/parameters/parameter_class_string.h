@@ -81,6 +81,7 @@ namespace parameters {
 		operator const T *() const noexcept;
 		// void operator=(T value);
 		void operator=(const T &value);
+		void operator=(T &&value);
 		void operator=(const T *value);
 
 		const T& operator () (void) const noexcept;
@@ -102,6 +103,8 @@ namespace parameters {
 
 		virtual void set_value(const char *v, SOURCE_REF) override;
 		void set_value(const T &v, SOURCE_REF);
+		// Move the incoming value through the validate and modify handlers into the parameter storage: no copies are made.
+		void set_value(T &&v, SOURCE_REF);
 
 		// the Param::set_value methods will not be considered by the compiler here, resulting in at least 1 compile error in params.cpp,
 		// due to this nasty little blurb:
@@ -127,7 +130,16 @@ namespace parameters {
 		// reckoned it'd bother all four of them: IntParam, FloatParam, etc.
 		using Param::set_value;
 
-		const T &value() const noexcept;
+		const T &value(CALL_SITE_REF_ONLY) const noexcept;
+
+		// Produce the current value for inspection (snapshots, epochs, ...): unlike value(), this is not counted as a read
+		// and does not touch any of the parameter's access administration.
+		//
+		// NOTE: this is a plain, unsynchronized access to the value: the returned reference (and any copy made from it) is only
+		// reliable when no other thread writes the parameter meanwhile, as a concurrent write may reallocate the string storage.
+		const T &raw_value() const noexcept {
+			return value_;
+		}
 
 		// Optionally the `source_vec` can be used to source the value to reset the parameter to.
 		// When no source vector is specified, or when the source vector does not specify this
@@ -140,7 +140,16 @@ namespace parameters {
 		// reckoned it'd bother all four of them: IntParam, FloatParam, etc.
 		using Param::set_value;
 
-		T value() const noexcept;
+		T value(CALL_SITE_REF_ONLY) const noexcept;
+
+		// Produce the current value for inspection (snapshots, epochs, ...): unlike value(), this is not counted as a read
+		// and does not touch any of the parameter's access administration.
+		//
+		// NOTE: this is a plain, unsynchronized read of the value: when another thread writes the parameter meanwhile, you may
+		// get the old or the new value, or (for types which are not written atomically by the platform) a torn mix of both.
+		T raw_value() const noexcept {
+			return value_;
+		}
 
 		// Optionally the `source_vec` can be used to source the value to reset the parameter to.
 		// When no source vector is specified, or when the source vector does not specify this
@@ -168,12 +177,20 @@ namespace parameters {
 		ParamOnFormatFunction set_on_format_handler(ParamOnFormatFunction on_format_f);
 		void clear_on_format_handler();
 
+		// Whether the value is formatted by the library's own format handler, i.e. when no custom format handler has been installed.
+		// The usage report uses this to format the value straight into its output buffer instead of going through value_str().
+		bool has_default_format_handler() const noexcept {
+			return on_format_f_is_default_;
+		}
+
 	protected:
 		ParamOnModifyFunction on_modify_f_;
 		ParamOnValidateFunction on_validate_f_;
 		ParamOnParseFunction on_parse_f_;
 		ParamOnFormatFunction on_format_f_;
 
+		bool on_format_f_is_default_;
+
 	protected:
 		T value_;
 		T default_;
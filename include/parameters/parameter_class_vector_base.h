@@ -13,7 +13,9 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <span>
 #include <functional>
+#include <memory>
 
 
 namespace parameters {
@@ -89,9 +91,22 @@ namespace parameters {
 		// Produce a reference to the parameter-internal assistant instance.
 		//
 		// Used, for example, by the parse handler, to obtain info about delimiters, etc., necessary to successfully parse a string value into a T object.
+		//
+		// NOTE: as the assistant may be modified through the non-const reference, obtaining it invalidates the parse cache (see enable_parse_cache()).
 		Assistant &get_assistant();
 		const Assistant &get_assistant() const;
 
+		// Opt-in memoization of the last parse result: when enabled, set_value(const char *) remembers the last successfully parsed
+		// input string and its parsed value, so that re-applying the identical input string skips the parse handler and goes
+		// straight to set_value(VecT): this is useful when the same (long) override values are re-applied over and over again.
+		// A cached result is only reused for the same source type (see ParamSetBySourceType), as that is passed to the parse handler as well.
+		//
+		// The cache is invalidated whenever the parse handler is changed or the assistant is accessed for modification.
+		// Binary blob file references (`@/path/to/file`) are never cached, as the referenced file may change between loads.
+		void enable_parse_cache(bool enable = true);
+		bool has_parse_cache() const noexcept;
+		void invalidate_parse_cache() noexcept;
+
 		operator const std::string &();
 		const char *c_str() const;
 
@@ -124,7 +139,85 @@ namespace parameters {
 		// reckoned it'd bother all four of them: IntParam, FloatParam, etc.
 		using Param::set_value;
 
-		const VecT &value() const noexcept;
+		const VecT &value(CALL_SITE_REF_ONLY) const noexcept;
+
+		// Element-level edits.
+		//
+		// Each of these counts as a single write action, runs the validate and modify handlers (at most) once and
+		// tracks an actual value change exactly like set_value() does.
+		//
+		// As long as the parameter uses the default (no-op) validate and modify handlers, these edit the parameter value
+		// in place and thus only cost O(1) for push_back() and set_element(), while erase() and ScopedEdit commits cost
+		// as much as the std::vector itself needs to shift the tail end of the array.
+		// When custom validate/modify handlers have been installed, those handlers expect complete old and new array values,
+		// hence a copy of the entire array is produced, edited and written via set_value() instead.
+		//
+		// Out-of-range element indexes are signaled as a (recoverable) fault; the parameter value is not adjusted then.
+		void push_back(const ElemT &v, SOURCE_REF);
+		void erase(size_t index, SOURCE_REF);
+		void set_element(size_t index, const ElemT &v, SOURCE_REF);
+
+		// A scoped, mutable edit of the element range [offset, offset + count) of the parameter value.
+		//
+		// The edit operates on a copy of the selected range, which the user may modify and even resize at will via elements();
+		// the edited range is written back into the parameter when the edit is committed, either by calling commit() explicitly
+		// or when the ScopedEdit instance goes out of scope. cancel() discards the edit.
+		// An exception thrown by a validate/modify handler during the implicit commit at the end of the scope cannot be propagated
+		// from the destructor: it is signaled as a fault of the parameter instead (see has_faulted()).
+		//
+		// Example:
+		//
+		//     {
+		//         auto ed = weights.edit(100, 3);
+		//         ed[0] = 0.5;
+		//         ed[2] *= 2;
+		//     }   // <-- written back here: one write, one validate+modify round, one change (if anything actually changed).
+		//
+		class ScopedEdit {
+		public:
+			ScopedEdit(ScopedEdit &&o) noexcept;
+			~ScopedEdit();
+
+			ScopedEdit(const ScopedEdit &o) = delete;
+			ScopedEdit &operator=(const ScopedEdit &other) = delete;
+			ScopedEdit &operator=(ScopedEdit &&other) = delete;
+
+			VecT &elements() noexcept {
+				return slice_;
+			}
+			typename VecT::reference operator[](size_t index) {
+				return slice_[index];
+			}
+			size_t size() const noexcept {
+				return slice_.size();
+			}
+
+			// Only available for element types which are stored contiguously, i.e. not for std::vector<bool>.
+			std::span<ElemT> span() noexcept requires (!std::is_same_v<ElemT, bool>) {
+				return std::span<ElemT>(slice_);
+			}
+
+			void commit();
+			void cancel() noexcept;
+
+		protected:
+			friend RTP;
+
+			ScopedEdit(RTP &param, size_t offset, size_t count, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM);
+
+		protected:
+			RTP *param_;
+			size_t offset_;
+			size_t count_;
+			VecT slice_;
+			ParamSetBySourceType source_type_;
+			ParamPtr source_;
+#if PARAMETERS_TRACK_CALL_SITES
+			std::source_location call_site_;
+#endif
+		};
+
+		ScopedEdit edit(size_t offset = 0, size_t count = SIZE_MAX, SOURCE_REF);
 
 		// Optionally the `source_vec` can be used to source the value to reset the parameter to.
 		// When no source vector is specified, or when the source vector does not specify this
@@ -152,12 +245,45 @@ namespace parameters {
 		ParamOnFormatFunction set_on_format_handler(ParamOnFormatFunction on_format_f);
 		void clear_on_format_handler();
 
+	protected:
+		// Replace the element range [offset, offset + count) of the parameter value with `replacement`:
+		// the shared workhorse of the element-level edit API above.
+		void splice_value(size_t offset, size_t count, VecT &&replacement, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM);
+		void report_edit_out_of_range(size_t index);
+		// The number of elements in the range [offset, offset + count) which differ from the default value; requires equal-sized arrays.
+		size_t count_default_diffs(size_t offset, size_t count) const;
+
+		// Check the parse cache for `input`, parsed on behalf of `source_type`: returns the cached parsed value when we have a match, NULL otherwise.
+		const VecT *parse_cache_lookup(const std::string &input, ParamSetBySourceType source_type) const;
+		void parse_cache_store(const std::string &input, ParamSetBySourceType source_type, const VecT &value);
+
+		struct ParseCache {
+			std::string input;
+			// the parse handler receives the source type as well, so a (custom) handler may produce a different value for the same input.
+			ParamSetBySourceType source_type;
+			VecT value;
+			bool valid{false};
+		};
+
 	protected:
 		ParamOnModifyFunction on_modify_f_;
 		ParamOnValidateFunction on_validate_f_;
 		ParamOnParseFunction on_parse_f_;
 		ParamOnFormatFunction on_format_f_;
 
+		// the element-level edits can take the in-place fast path only while these handlers are the (no-op) defaults:
+		bool on_modify_f_is_default_;
+		bool on_validate_f_is_default_;
+
+		// only allocated when the parse cache has been enabled:
+		std::unique_ptr<ParseCache> parse_cache_;
+
+		// The number of elements which differ from the default value, valid only as long as the parameter still carries
+		// write version `default_diff_version_`: this lets the element-level edits keep the non-default state up to date
+		// at the cost of the edited range, instead of comparing the entire array on every edit.
+		size_t default_diff_count_ = 0;
+		uint64_t default_diff_version_ = 0;
+
 	protected:
 		VecT value_;
 		VecT default_;
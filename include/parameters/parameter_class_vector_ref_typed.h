@@ -125,7 +125,7 @@ namespace parameters {
 		// reckoned it'd bother all four of them: IntParam, FloatParam, etc.
 		using Param::set_value;
 
-		const VecT &value() const noexcept;
+		const VecT &value(CALL_SITE_REF_ONLY) const noexcept;
 
 		// Optionally the `source_vec` can be used to source the value to reset the parameter to.
 		// When no source vector is specified, or when the source vector does not specify this
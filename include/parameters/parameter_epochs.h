@@ -0,0 +1,153 @@
+
+#ifndef _LIB_PARAMS_EPOCHS_H_
+#define _LIB_PARAMS_EPOCHS_H_
+
+#include <parameters/parameter_classes.h>
+#include <parameters/parameter_snapshots.h>
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace parameters {
+
+	class ParamsVectorSet;
+
+	// An immutable set of parameter values, to be shared among threads via a ParamsEpochPublisher.
+	//
+	// An epoch is a copy of the parameter values at the time it was captured: later writes to the parameters
+	// do not affect it, so readers which use the epoch instead of the live parameters never observe torn (string) values
+	// and see one consistent configuration for the duration of a work unit.
+	class ParamsEpoch {
+	public:
+		// Capture the current values of all parameters in the given sets.
+		//
+		// The values are copied via raw_value(), which does not synchronize with the parameter writers: Capture() must run on
+		// the thread which writes the parameters, or be otherwise serialized with those writers (e.g. under the lock which
+		// serializes the configuration updates), or it may copy torn values.
+		static std::unique_ptr<const ParamsEpoch> Capture(const ParamsVectorSet *globals, const ParamsVectorSet *locals);
+
+		ParamsEpoch(const ParamsEpoch &o) = delete;
+		ParamsEpoch &operator=(const ParamsEpoch &other) = delete;
+
+		// Fetch the parameter value as it was when this epoch was captured.
+		//
+		// Throws a std::logic_error when the parameter is not part of this epoch.
+		int32_t value(const IntParam &param) const;
+		bool value(const BoolParam &param) const;
+		double value(const DoubleParam &param) const;
+		const std::string &value(const StringParam &param) const;
+
+		// The typed value of any parameter; other than int, bool, double and string parameters are carried in serialized form.
+		// Returns NULL when the parameter is not part of this epoch.
+		const SnapshotValue *find(const Param &param) const noexcept;
+
+		bool contains(const Param &param) const noexcept;
+		size_t size() const noexcept;
+
+		// Sequence number of this epoch: epochs captured later carry a larger number.
+		uint64_t serial() const noexcept;
+
+	protected:
+		ParamsEpoch() = default;
+
+		const SnapshotValue &fetch(const Param &param) const;
+
+	protected:
+		std::unordered_map<const Param *, SnapshotValue> values_;
+		uint64_t serial_ = 0;
+	};
+
+	// Publishes immutable parameter epochs to reader threads, RCU style.
+	//
+	// Writers build a new epoch and Publish() it, which atomically replaces the current epoch.
+	// Readers Pin() the current epoch for the duration of a work unit using a ReadGuard; pinning costs a few atomic operations
+	// and never blocks: readers don't take any lock. Writers are serialized among themselves by a mutex.
+	//
+	// Epochs which have been replaced are retired and reclaimed as soon as no reader pins them any more.
+	// Reclamation is performed by the writers (Publish() and Reclaim()), never by the readers.
+	class ParamsEpochPublisher {
+	public:
+		// The maximum number of simultaneously pinned epochs. When all pin slots are in use, Pin() spins until a slot is released.
+		static constexpr size_t MAX_READERS = 256;
+
+		ParamsEpochPublisher();
+		// The destructor discards all epochs: no reader may pin any epoch at that time.
+		~ParamsEpochPublisher();
+
+		ParamsEpochPublisher(const ParamsEpochPublisher &o) = delete;
+		ParamsEpochPublisher &operator=(const ParamsEpochPublisher &other) = delete;
+
+		class ReadGuard {
+			friend class ParamsEpochPublisher;
+
+		public:
+			ReadGuard(ReadGuard &&o) noexcept;
+			~ReadGuard();
+
+			ReadGuard(const ReadGuard &o) = delete;
+			ReadGuard &operator=(const ReadGuard &other) = delete;
+			ReadGuard &operator=(ReadGuard &&other) = delete;
+
+			// The pinned epoch; NULL when nothing had been published yet at the time of pinning.
+			const ParamsEpoch *epoch() const noexcept {
+				return epoch_;
+			}
+			const ParamsEpoch *operator->() const noexcept {
+				return epoch_;
+			}
+			operator bool() const noexcept {
+				return epoch_ != nullptr;
+			}
+
+			// Unpin the epoch before the guard goes out of scope.
+			void release() noexcept;
+
+		protected:
+			ReadGuard(const ParamsEpochPublisher &publisher);
+
+		protected:
+			const ParamsEpochPublisher *publisher_;
+			size_t slot_;
+			const ParamsEpoch *epoch_;
+		};
+
+		// Pin the current epoch.
+		ReadGuard Pin() const;
+
+		// Replace the current epoch. The publisher takes ownership of the epoch.
+		void Publish(std::unique_ptr<const ParamsEpoch> epoch);
+
+		// Capture and publish the current values of all parameters in the given sets. See ParamsEpoch::Capture() for the
+		// constraints on the calling thread.
+		void Publish(const ParamsVectorSet *globals, const ParamsVectorSet *locals);
+
+		// Reclaim the retired epochs which are not pinned any more.
+		void Reclaim();
+
+		// The number of retired epochs which are still waiting to be reclaimed.
+		size_t RetiredCount() const;
+
+	protected:
+		// must be invoked while holding writer_lock_.
+		void ReclaimUnpinned();
+
+	protected:
+		std::atomic<const ParamsEpoch *> current_;
+
+		// One slot per active ReadGuard, carrying the epoch it pins. A slot is either free (NULL), claimed (the
+		// `claimed_slot` marker) or protecting an epoch.
+		mutable std::atomic<const ParamsEpoch *> slots_[MAX_READERS];
+
+		mutable std::mutex writer_lock_;
+		std::vector<const ParamsEpoch *> retired_;
+	};
+
+}	// namespace
+
+#endif
@@ -9,7 +9,9 @@
 
 #include <parameters/parameter_classes.h>
 
+#include <atomic>
 #include <cstdint>
+#include <deque>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -60,6 +62,23 @@ namespace parameters {
 
 	// --------------------------------------------------------------------------------------------------
 
+	// The access counts of a single parameter during a single section, as recorded in the section history of a ParamsVector.
+	struct ParamSectionCounts {
+		ParamPtr param;
+		uint32_t reading;
+		uint32_t writing;
+		uint32_t changing;
+		uint32_t faulting;
+	};
+
+	// The access counts of all parameters which have been accessed during a single section.
+	struct ParamsSectionRecord {
+		uint64_t section;                           // sequence number of the section; the first section is number 1.
+		std::vector<ParamSectionCounts> counts;     // in no particular order
+	};
+
+	// --------------------------------------------------------------------------------------------------
+
 	// A set (vector) of parameters. While this is named *vector* the internal organization
 	// is hash table based to provide fast random-access add / remove / find functionality.
 	class ParamsVector {
@@ -68,6 +87,28 @@ namespace parameters {
 		bool is_params_owner_ = false;
 		std::string title_;
 
+		// cache for sorted_list(); invalidated by add() and remove().
+		mutable std::vector<ParamPtr> sorted_params_;
+		mutable bool sorted_params_valid_ = false;
+
+		// the dirty set: the parameters owned by this vector which have been accessed since the last reset_access_counts().
+		// Maintained by the parameters themselves on first access (see Param::count_access()), which may happen in multiple
+		// threads at once, hence this is a lock-free, intrusive singly linked list (via Param::next_touched_), most recent first.
+		// Only accessed through std::atomic_ref, so the ParamsVector remains copyable.
+		mutable Param *touched_head_ = nullptr;
+		// touched_list(): the dirty set in report order, collected from the linked list up to `touched_collected_`,
+		// which is the list head at the time of the last collection.
+		std::vector<ParamPtr> touched_params_;
+		Param *touched_collected_ = nullptr;
+		// the number of parameters in this set which register their accesses with another vector's dirty set.
+		// (conservative: a parameter owned by us, which has been removed from this set, still counts.)
+		size_t untracked_params_ = 0;
+
+		// the bounded per-section history, recorded by reset_access_counts(); oldest section first.
+		std::deque<ParamsSectionRecord> section_history_;
+		size_t section_history_depth_ = 16;
+		uint64_t section_count_ = 0;
+
 	public:
 		ParamsVector() = delete;
 		ParamsVector(const char* title);
@@ -119,8 +160,59 @@ namespace parameters {
 			ParamType accepted_types_mask = ANY_TYPE_PARAM
 		) const;
 
+		// The parameters in report order, i.e. sorted by (init, debug, name): 'init' parameters first, 'debug' parameters last
+		// and ordered by name otherwise.
+		//
+		// The list is produced on first use and cached until the next add() or remove(), so repeated reports don't pay
+		// for sorting over and over again. The returned reference remains valid until then.
+		const std::vector<ParamPtr> &sorted_list() const;
+
+		// The parameters owned by this vector which have been accessed since the last reset_access_counts(), in report order.
+		//
+		// This list only covers *all* accessed parameters in this set when tracks_all_accesses() says so: parameters owned by
+		// another vector register their accesses over there.
+		// Only the parameters which have been accessed since the previous touched_list() call are collected (and the list is only
+		// re-sorted) when invoked again.
+		// The returned reference remains valid until the next touched_list(), remove() or reset_access_counts() call.
+		const std::vector<ParamPtr> &touched_list();
+
+		// Returns true when touched_list() is guaranteed to carry every parameter in this set which has been accessed since the
+		// last reset_access_counts(), i.e. when this vector owns every parameter it carries.
+		bool tracks_all_accesses() const noexcept;
+
+		// Reset the access counters of the parameters in this set and clear the dirty set.
+		//
+		// This costs O(touched) instead of O(all parameters) when tracks_all_accesses() is true.
+		//
+		// The counts are recorded as a completed section in the section history, unless `record_history` is false: use that to
+		// merely fold the current counts into the run totals, e.g. when producing a lump-sum report, which doesn't end a section.
+		void reset_access_counts(bool record_history = true);
+
+		// Keep the access counts of (at most) the last `depth` sections, as recorded by reset_access_counts(). 0 disables the history.
+		void set_section_history_depth(size_t depth);
+
+		// The access counts per section, oldest first, for the (at most) section_history_depth last completed sections.
+		const std::deque<ParamsSectionRecord> &section_history() const noexcept;
+
+		// Start (or stop) recording the access timestamps of every parameter in this set; see Param::track_access_times().
+		void track_access_times(bool enable = true);
+
+		// Start (or stop) timing the event handler invocations of every parameter in this set; see Param::track_handler_timings().
+		void track_handler_timings(bool enable = true);
+
+		// The report order: 'init' parameters first, 'debug' parameters last and ordered by name otherwise.
+		static bool report_order_less(const ParamPtr &a, const ParamPtr &b);
+
+	protected:
+		// register a parameter in the dirty set; invoked by the parameter on its first access in a section.
+		void push_touched(Param *p) const noexcept;
+		// remove a parameter from the dirty set.
+		void unlink_touched(Param *p);
+
+	public:
 		friend class ParamsVectorSet;
 		friend class Snapshot;
+		friend class Param;
 	};
 
 	// --------------------------------------------------------------------------------------------------
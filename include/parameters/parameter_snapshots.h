@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <string>
 #include <vector>
+#include <unordered_set>
+#include <unordered_map>
 #include <variant>
 
 
@@ -18,40 +20,287 @@ namespace parameters {
 
 	typedef Snapshot *SnapshotPtr;
 
+	// Snapshot files, used to persist a parameter state across process runs (see Snapshot::SaveToFile() and Snapshot::RestoreFromFile()).
+	//
+	// File layout: a 48 byte header (see below), followed by these sections, all values stored little-endian:
+	//
+	// - int32_t   int values[int_count]
+	// - double    double values[double_count]
+	// - uint32_t  string ends[string_count]            -- offsets into the string arena, one past the end of each string
+	// - uint32_t  other ends[other_count]              -- offsets into the 'other' arena, one past the end of each serialized value
+	// - uint16_t  other types[other_count]             -- ParamType of each 'other' parameter
+	// - uint8_t   bool values[bool_count]
+	// - char      names[names_size]                    -- the normalized parameter names, NUL-terminated, in order: int, bool, double, string, other
+	// - char      string arena[string_arena_size]
+	// - char      other arena[other_arena_size]
+	//
+	// Parameter names are normalized (lowercase, '-' replaced by '_') so the file doesn't depend on the spelling used at registration.
+
+	struct SnapshotFileHeader {
+		char magic[4];                  // "PSNP"
+		uint16_t version;               // format version; currently 1.
+		uint16_t reserved;              // must be zero
+		uint64_t schema_fingerprint;    // Snapshot::SchemaFingerprint() of the parameter sets the file was produced from
+		uint32_t int_count;
+		uint32_t bool_count;
+		uint32_t double_count;
+		uint32_t string_count;
+		uint32_t other_count;
+		uint32_t names_size;
+		uint32_t string_arena_size;
+		uint32_t other_arena_size;
+	};
+	static_assert(sizeof(SnapshotFileHeader) == 48);
+
+	// --------------------------------------------------------------------------------------------------
+
+	// A typed parameter value, as produced by the snapshot diff API (see SnapshotSeries::Diff()).
+	// Parameter types other than int, bool, double and string are carried in their serialized form (see Param::raw_value_str()).
+	typedef std::variant<int32_t, bool, double, std::string> SnapshotValue;
+
+	struct SnapshotValueChange {
+		Param *param;
+		SnapshotValue old_value;
+		SnapshotValue new_value;
+	};
+	typedef std::vector<SnapshotValueChange> SnapshotDiff;
+
+	// --------------------------------------------------------------------------------------------------
+
+	// Compact storage for a set of recorded parameter values, used by the snapshots.
+	//
+	// The values are stored in a structure-of-arrays layout: a dense value array per value type, accompanied by a parallel array
+	// of parameter references, while all string data is kept in a single arena, referenced by end offsets.
+	// (The serialized values of the 'other' parameter types get an arena of their own.)
+	// Recording and restoring values thus boils down to a sequence of tight loops, one per type.
+	//
+	// Parameter types which are not int, bool, double or string are recorded in their serialized form (see Param::raw_value_str()).
+	class SnapshotValues {
+	public:
+		SnapshotValues() = default;
+
+		// Record the current value of the parameter.
+		void Record(Param *p);
+
+		// Restore all recorded values.
+		//
+		// Values are restored in reverse order of recording, so when a parameter has been recorded multiple times, its oldest recorded value wins.
+		void RestoreAll() const;
+
+		// Restore the recorded values of the parameters which have been changed after `version_stamp` (see Param::version()),
+		// unless they are already listed in `restored`. Every parameter restored is added to `restored`.
+		void RestoreChanged(uint64_t version_stamp, std::unordered_set<Param *> &restored) const;
+
+		// Append the records of `src` for the parameters which have been changed after `version_stamp`, unless they are already listed in `seen`.
+		// Every parameter appended is added to `seen`.
+		void AppendChanged(const SnapshotValues &src, uint64_t version_stamp, std::unordered_set<Param *> &seen);
+
+		// Add the recorded values to `dst`. When a parameter has been recorded multiple times, its first recorded value wins.
+		void ExportValues(std::unordered_map<Param *, SnapshotValue> &dst) const;
+
+		// Fetch the current value of the parameter, in the form Record() would store it. This does not count as a read access.
+		static SnapshotValue CurrentValue(Param *p);
+
+		// Write the recorded values to a snapshot file (see SnapshotFileHeader). Returns false on (I/O) error.
+		bool WriteFile(const char *path, uint64_t schema_fingerprint) const;
+
+		// Add the records of `src` for the parameters which have not been recorded here yet.
+		void MergeMissing(const SnapshotValues &src);
+
+		size_t size() const noexcept;
+		bool empty() const noexcept;
+		void clear() noexcept;
+		void shrink_to_fit();
+
+		// The number of bytes of heap memory occupied by the recorded values.
+		size_t memory_usage() const noexcept;
+
+	protected:
+		// fetch string i from the given arena.
+		static std::string arena_string(const std::string &arena, const std::vector<uint32_t> &ends, size_t i);
+
+	protected:
+		std::vector<Param *> int_params;
+		std::vector<int32_t> int_values;
+
+		std::vector<Param *> bool_params;
+		std::vector<uint8_t> bool_values;		// not std::vector<bool>, which is slow to index and a special animal anyway
+
+		std::vector<Param *> double_params;
+		std::vector<double> double_values;
+
+		std::vector<Param *> string_params;
+		std::vector<uint32_t> string_ends;		// offsets into the arena, one past the end of each string
+		std::string string_arena;
+
+		// all other parameter types, stored in serialized form:
+		std::vector<Param *> other_params;
+		std::vector<uint32_t> other_ends;
+		std::string other_arena;
+	};
+
 	class Snapshot {
 		friend class SnapshotSeries;
 
 	protected:
-		Snapshot(const char *name = nullptr);
+		Snapshot(const char *name = nullptr, const Snapshot *parent = nullptr);
 		~Snapshot() = default;
 
-		static SnapshotPtr TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals);
+		// Take a snapshot of the parameters in the given sets.
+		//
+		// When a `parent` snapshot is specified, this produces a *delta snapshot*: only the parameters which have changed since the
+		// parent snapshot was taken (as determined by their write version, see Param::version()) are recorded.
+		// Otherwise, all parameters are recorded.
+		static SnapshotPtr TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals, const Snapshot *parent = nullptr);
+
+		// Restore the parameters to the state recorded in the snapshot (chain).
+		//
+		// Only the parameters which have changed since the snapshot was taken are reset; their values are fetched from the
+		// snapshot itself or, when the snapshot is a delta snapshot which did not record that parameter, from the nearest ancestor which did.
 		static void ResetToSnapshot(Snapshot &snapshot);
 
+		// Record the current value of every parameter in the given sets which is not listed in `seen` yet.
+		static void RecordCurrentState(SnapshotValues &dst, const ParamsVectorSet *globals, const ParamsVectorSet *locals, std::unordered_set<Param *> &seen);
+
+		// The number of bytes of memory occupied by this snapshot.
+		size_t memory_usage() const noexcept;
+
+	public:
+		// Produce a fingerprint of the parameter schema, i.e. the (normalized) names and types of all parameters in the given sets.
+		// The order in which the parameters have been registered does not matter.
+		static uint64_t SchemaFingerprint(const ParamsVectorSet *globals, const ParamsVectorSet *locals);
+
+		// Persist the current values of the parameters in the given sets to a snapshot file. Returns false on (I/O) error.
+		static bool SaveToFile(const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals);
+
+		// Restore the parameter values stored in a snapshot file, e.g. to warm-start a process in the exact state of a previous run.
+		//
+		// The file is loaded and applied in a single pass: int, bool, double and string values are assigned as-is, without any text parsing.
+		// When the file was produced for a different parameter schema (see SchemaFingerprint()), the values are restored by name and
+		// the parameters which are unknown (or of another type) are skipped, unless `require_matching_schema` is set,
+		// in which case the file is rejected instead.
+		//
+		// Returns false when the file could not be loaded or was rejected.
+		static bool RestoreFromFile(const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals, bool require_matching_schema = false);
+
 	protected:
 		std::string name;
 
-		struct datums {
-			Param *param_ref;
-			std::variant<int32_t, bool, double, std::string> value;
-			Param::access_counts_t stats;
-		};
+		// the snapshot this delta snapshot is based on; NULL for a full snapshot.
+		const Snapshot *parent;
+		// Param::current_version() at the time this snapshot was taken.
+		uint64_t version_stamp;
 
-		std::vector<datums> data;
+		SnapshotValues data;
+
+		// Journaling mode (see SnapshotSeries::EnableJournaling()): the original values of the parameters which have been changed
+		// since this snapshot point, in order of occurrence.
+		SnapshotValues undo_log;
+	};
+
+	// What SnapshotSeries does with the older snapshots when it exceeds its budget (see SnapshotSeries::SetBudget()).
+	enum SnapshotCompactionMode {
+		// Drop the oldest snapshot. Rewinding remains possible to the most recent snapshots only.
+		SNAPSHOT_EVICT_OLDEST = 0,
+		// Keep the first (base) snapshot and drop the one following it, merging its data into the next snapshot.
+		// Rewinding remains possible to the base snapshot and the most recent snapshots.
+		SNAPSHOT_KEEP_BASE,
 	};
 
 	class SnapshotSeries {
-	protected:
+		friend class Param;
+
+	public:
 		SnapshotSeries() = default;
 		~SnapshotSeries();
 
-	public:
+		SnapshotSeries(const SnapshotSeries &o) = delete;
+		SnapshotSeries &operator=(const SnapshotSeries &other) = delete;
+
 		Snapshot &TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals);
 		void RewindToSnapshot(Snapshot &snapshot);
 		void PopSnapshot();
 
+		// Persist the parameter state as it was at the time the given snapshot was taken to a snapshot file (see Snapshot::SaveToFile()).
+		// Returns false on (I/O) error or when the snapshot is not part of this series.
+		bool SaveSnapshot(const Snapshot &snapshot, const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals) const;
+
+		// Limit the number of snapshots kept in the series and/or the memory they occupy; a zero limit means 'unlimited'.
+		//
+		// When taking a snapshot exceeds the budget, older snapshots are dropped according to `mode` until the series fits
+		// the budget again. The most recent snapshot is never dropped, while in SNAPSHOT_KEEP_BASE mode the first one isn't either.
+		// Dropped snapshots are destroyed: they cannot be rewound to any more (RewindToSnapshot() will throw) and any reference
+		// to them is invalid. All other snapshots remain valid rewind targets as the data of a dropped snapshot is merged into
+		// its neighbour where needed.
+		void SetBudget(size_t max_snapshots, size_t max_memory_bytes, SnapshotCompactionMode mode = SNAPSHOT_EVICT_OLDEST);
+
+		// Drop snapshots until the series fits its budget again. This is done automatically when a snapshot is taken, but in journaling
+		// mode the undo logs keep growing after that, so long-running applications may want to invoke this periodically.
+		void EnforceBudget();
+
+		// The number of snapshots in the series.
+		size_t size() const noexcept;
+
+		// The number of bytes of memory occupied by the snapshots in the series.
+		size_t memory_usage() const noexcept;
+
+		// The number of snapshots dropped so far to fit the budget.
+		size_t dropped_count() const noexcept;
+
+		// Report the parameters which currently have a different value than they had at the time the given snapshot was taken,
+		// with both their old and new values.
+		//
+		// Only the parameters which have been written since the snapshot (as determined by their write version, see Param::version())
+		// are inspected, so the cost depends on the number of changes rather than the number of parameters. In journaling mode
+		// this is strictly true; otherwise the recorded snapshot chain is scanned, but only version stamps are compared for the
+		// parameters which have not been written to.
+		//
+		// Throws a std::logic_error when the snapshot is not part of this series.
+		SnapshotDiff DiffToCurrent(const Snapshot &snapshot) const;
+
+		// Report the parameters which have a different value at snapshot `to` than at snapshot `from`, with their values at both points.
+		// Either snapshot may be the older one.
+		//
+		// Throws a std::logic_error when either snapshot is not part of this series.
+		SnapshotDiff Diff(const Snapshot &from, const Snapshot &to) const;
+
+		// Journaling mode: instead of copying parameter values when a snapshot is taken, the *first* change of each parameter after
+		// a snapshot point is recorded (parameter + old value) in an undo log. Taking a snapshot then costs next to nothing, while
+		// RewindToSnapshot() and PopSnapshot() only replay the undo logs in reverse, thus costing O(changes) rather than O(parameters).
+		//
+		// Journaling can only be switched on or off while the series is empty, and only one series can be journaling at any time.
+		void EnableJournaling(bool enable = true);
+		bool IsJournaling() const noexcept;
+
+	protected:
+		// Invoked by Param::note_value_change() for the first change of a parameter since the journal mark.
+		void JournalParamChange(Param *p);
+
+		// Collect the values, as they were at the time the snapshot was taken, of all parameters which have been changed since.
+		// Parameters already listed in `seen` are skipped; every parameter collected is added to `seen`.
+		//
+		// Returns false when the snapshot is not part of this series.
+		bool CollectValuesAt(const Snapshot &snapshot, SnapshotValues &dst, std::unordered_set<Param *> &seen) const;
+
+		// Remove snapshot `index` from the series, merging its data into its neighbour so the other snapshots stay valid.
+		// This must not be the most recent snapshot.
+		void DropSnapshot(size_t index);
+
+		// Replay the undo log of the given snapshot in reverse, then clear it.
+		void ReplayUndoLog(Snapshot &snapshot);
+
 	protected:
 		std::vector<SnapshotPtr> series;
+
+		bool journaling = false;
+		// Param::current_version() at the last snapshot point (snapshot taken or rewound to): any parameter with
+		// a version at or below this mark has not been journaled yet.
+		uint64_t journal_mark = 0;
+
+		size_t max_snapshots = 0;
+		size_t max_memory = 0;
+		SnapshotCompactionMode compaction_mode = SNAPSHOT_EVICT_OLDEST;
+		size_t dropped = 0;
 	};
 
 }	// namespace
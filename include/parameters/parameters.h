@@ -10,8 +10,10 @@
 #include <parameters/parameter_classes.h>
 #include <parameters/parameter_sets.h>
 #include <parameters/parameter_snapshots.h>
+#include <parameters/parameter_epochs.h>
 #include <parameters/parameter_globals.h>
 #include <parameters/parameter_class_assistant.h>
+#include <parameters/binaryblob.h>
 #include <parameters/utilities.h>
 #include <parameters/configreader.h>
 #include <parameters/reportwriter.h>
@@ -19,6 +21,8 @@
 #include <parameters/stdioreportwriter.h>
 #include <parameters/stringconfigreader.h>
 #include <parameters/stringreportwriter.h>
+#include <parameters/usage_statistics.h>
+#include <parameters/shared_stats_export.h>
 #include <parameters/HelperMacros.hpp>
 #include <parameters/CString.hpp>
 
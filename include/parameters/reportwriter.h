@@ -11,7 +11,12 @@
 #include <parameters/parameter_sets.h>
 #include <parameters/CString.hpp>
 
+#include <fmt/format.h>
+
 #include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
 
 
 namespace parameters {
@@ -34,6 +39,11 @@ namespace parameters {
 			PARAMREPORT_CUSTOM_OUTPUT = 0,
 			PARAMREPORT_AS_MARKDOWN_REPORT = 1,
 			PARAMREPORT_AS_CONFIGFILE,
+			// machine-readable output: a single JSON array of records.
+			PARAMREPORT_AS_JSON,
+			// machine-readable output: one JSON record per line (a.k.a. JSON Lines / NDJSON), so consumers can process the report
+			// while it is being produced.
+			PARAMREPORT_AS_JSON_LINES,
 		};
 		enum LineContentPurpose: int {
 			PARAMREPORT_TERMINATION_AKA_THE_END = 0,
@@ -81,9 +91,63 @@ namespace parameters {
 		void WriteInfoParagraph(const std::string &message);
 		void WriteOther(LineContentPurpose purpose, const std::string &message);
 
+		// Streaming output: format the line content straight into the line buffer, then complete the line using EndLine(),
+		// which passes it on to the postprocessor. This prevents the need for any intermediate (temporary) strings.
+		//
+		//     size_t start = dst.BeginLine();
+		//     dst.Format("* {:.<60} = {}\n", param.name_str(), value);
+		//     dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start, &param);
+		size_t BeginLine() const {
+			return _buffer.length();
+		}
+		template <typename... T>
+		void Format(fmt::format_string<T...> fmt, T&&... args) {
+			fmt::format_to(std::back_inserter(_buffer), fmt, std::forward<T>(args)...);
+		}
+		void Append(const char *str) {
+			_buffer.append(str);
+		}
+		void Append(const std::string &str) {
+			_buffer.append(str.c_str(), str.size());
+		}
+		void EndLine(LineContentPurpose purpose, size_t line_start_pos, const Param *param = nullptr);
+
+		// Returns true when this report is produced as JSON (PARAMREPORT_AS_JSON or PARAMREPORT_AS_JSON_LINES).
+		// The Write*() methods then produce JSON records instead of text lines; the table legenda is not reported.
+		bool IsJSONOutput() const noexcept {
+			return _type == PARAMREPORT_AS_JSON || _type == PARAMREPORT_AS_JSON_LINES;
+		}
+
+		// Write a JSON record describing the parameter: name, type, value, default value, set mode, attributes and the given
+		// access counters; negative counter values are not reported. The record is streamed straight into the line buffer.
+		//
+		// This is what WriteParamInfoLine() produces in JSON mode, using the parameter's current access counts.
+		void WriteParamRecord(const Param &param, int64_t writing, int64_t reading, int64_t changing = -1, int64_t faulting = -1, bool with_description = false);
+
+		// Streaming output of custom JSON records: BeginJSONRecord() emits the record separator (and the opening bracket of the document)
+		// and returns the line start position to pass to EndJSONRecord(), which completes the record and passes it on to the postprocessor.
+		//
+		//     size_t start = dst.BeginJSONRecord();
+		//     dst.Append("{\"name\":");
+		//     dst.AppendJSONString(name);
+		//     dst.Append("}");
+		//     dst.EndJSONRecord(ReportWriter::PARAMREPORT_ITEM_LIST, start);
+		size_t BeginJSONRecord();
+		void EndJSONRecord(LineContentPurpose purpose, size_t line_start_pos, const Param *param = nullptr);
+		// Append the string as a quoted and escaped JSON string.
+		void AppendJSONString(const char *str);
+		void AppendJSONString(const std::string &str);
+
+		// Once the line buffer has grown beyond this size, it is flushed to the output (see WriteLineBuffer()),
+		// so the memory footprint of a report does not depend on the number of parameters reported.
+		static constexpr size_t FLUSH_THRESHOLD = 64 * 1024;
+
 	protected:
 		virtual void WriteLineBuffer();
 
+		// JSON output: complete the document. Invoked by Finalize(); any subsequent invocation is a no-op.
+		void CloseJSONDocument();
+
 	public:
 		virtual void Finalize();
 
@@ -92,6 +156,11 @@ namespace parameters {
 		CString<> _buffer;
 		int _active_level;
 		ReportType _type;
+
+		// JSON output state:
+		std::string _active_heading;    // reported with each parameter record, so JSON Lines records are self-contained
+		size_t _json_record_count;
+		bool _json_closed;
 	};
 
 } // namespace 
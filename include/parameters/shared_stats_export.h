@@ -0,0 +1,148 @@
+
+#ifndef _LIB_PARAMS_SHARED_STATS_EXPORT_H_
+#define _LIB_PARAMS_SHARED_STATS_EXPORT_H_
+
+#include <parameters/parameter_classes.h>
+#include <parameters/parameter_sets.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace parameters {
+
+	// --------------------------------------------------------------------------------------------------
+
+	// SharedStatsExport, et al, used to export the live parameter access counters and scalar values through a named shared memory
+	// segment, so an external inspector process can observe a (stalled) application without having to stop or signal it.
+	//
+	// The export is opt-in: construct a SharedStatsExport instance for the parameter set of interest. A background thread then
+	// copies the counters and values into the segment at the given interval; the threads using the parameters are not involved.
+	//
+	// Segment layout (native byte order, as the inspector runs on the same machine):
+	//
+	// - SharedStatsHeader
+	// - SharedStatsSlot    slots[slot_count]
+	// - char               names[names_size]    -- the parameter names, NUL-terminated
+	//
+	// An inspector reads a consistent set of slots like this (seqlock protocol):
+	//
+	//     do {
+	//         seq = header->sequence;                // (acquire) odd: the publisher is updating the slots; retry
+	//         copy the slots;
+	//     } while ((seq & 1) || seq != header->sequence);
+	//
+	// The names, types and offsets never change during the lifetime of the segment.
+	//
+	// NOTE: the seqlock only orders the publisher's slot updates against the inspector; it does not synchronize with the threads
+	// using the parameters. The publisher reads the access counters and values (see ValueTypedParam::raw_value()) while those threads may
+	// be updating them, so a slot may carry stale counts or a value which is stale or, for doubles on platforms without atomic
+	// 64-bit stores, torn. This is the price for keeping the parameter access paths free of any synchronization.
+
+	struct SharedStatsHeader {
+		char magic[4];                      // "PSHM"
+		uint16_t version;                   // format version; currently 1.
+		uint16_t slot_size;                 // sizeof(SharedStatsSlot)
+		uint32_t slot_count;
+		uint32_t names_offset;              // offset of the names arena from the start of the segment
+		uint32_t names_size;
+		uint32_t pid;                       // the exporting process
+		std::atomic<uint64_t> sequence;     // incremented before and after each publication
+		int64_t publish_time;               // time of the last publication, in milliseconds since the epoch
+	};
+	static_assert(sizeof(SharedStatsHeader) == 40);
+	static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+	enum SharedStatsFlags : uint8_t {
+		SHAREDSTATS_IS_INIT = 0x01,
+		SHAREDSTATS_IS_DEBUG = 0x02,
+		SHAREDSTATS_IS_NON_DEFAULT = 0x04,
+		SHAREDSTATS_HAS_FAULTED = 0x08,
+		SHAREDSTATS_HAS_INT_VALUE = 0x10,   // `value.i` carries the value of an int or bool parameter
+		SHAREDSTATS_HAS_DOUBLE_VALUE = 0x20,// `value.d` carries the value of a double parameter
+	};
+
+	struct SharedStatsSlot {
+		uint32_t name_offset;               // offset of the (NUL-terminated) parameter name in the names arena
+		uint16_t type;                      // ParamType
+		uint8_t set_mode;                   // ParamSetBySourceType
+		uint8_t flags;                      // SharedStatsFlags
+
+		// the current section's access counts
+		uint32_t reading;
+		uint32_t writing;
+		uint32_t changing;
+		uint32_t faulting;
+
+		// the access counts of the run thus far, i.e. the totals of all sections, including the current one.
+		uint64_t total_reading;
+		uint64_t total_writing;
+		uint64_t total_changing;
+		uint64_t total_faulting;
+
+		union {
+			int64_t i;
+			double d;
+		} value;                            // only scalar parameter values are exported
+		uint64_t version;                   // Param::version(): changes whenever the value changes
+	};
+	static_assert(sizeof(SharedStatsSlot) == 72);
+
+	class SharedStatsExport {
+	public:
+		// Create the shared memory segment `name` (a POSIX shared memory object name, e.g. "/myapp-params", or a named file mapping
+		// on Windows), describing all parameters currently in the given set, and start publishing at the given interval.
+		//
+		// The set of exported parameters is fixed at construction time: the parameters must outlive this instance.
+		// Use `operator bool()` to check whether the segment was created successfully; `error_message()` produces a
+		// human readable description of the problem when it wasn't.
+		SharedStatsExport(const char *name, const ParamsVectorSet &set, std::chrono::milliseconds interval = std::chrono::milliseconds(100));
+		// Stops publishing and removes the shared memory segment.
+		~SharedStatsExport();
+
+		SharedStatsExport(const SharedStatsExport &o) = delete;
+		SharedStatsExport &operator=(const SharedStatsExport &other) = delete;
+
+		operator bool() const {
+			return _header != nullptr;
+		};
+
+		const std::string &error_message() const;
+		const std::string &name() const;
+
+		// Publish the current counters and values right away, e.g. just before a long running operation.
+		void Publish();
+
+	protected:
+		void create(const ParamsVectorSet &set);
+		void destroy();
+		void run();
+
+	protected:
+		std::string _name;
+		std::string _errmsg;
+		std::vector<ParamPtr> _params;
+
+		SharedStatsHeader *_header;         // start of the mapped segment; NULL on error
+		SharedStatsSlot *_slots;
+		size_t _size;
+#if defined(_WIN32)
+		void *_mapping_handle;
+#endif
+
+		std::chrono::milliseconds _interval;
+		std::mutex _lock;                   // serializes publications and guards _stop
+		std::condition_variable _wakeup;
+		bool _stop;
+		std::thread _publisher;
+	};
+
+} // namespace
+
+#endif
@@ -3,6 +3,8 @@
 
 #undef SOURCE_TYPE															
 #undef SOURCE_REF																
+#undef CALL_SITE_REF
+#undef CALL_SITE_REF_ONLY
 #undef THE_4_HANDLERS_PROTO
 #undef THE_4_HANDLERS_PROTO_4_SURPLUS
 #undef MK_CONSTRUCTORS
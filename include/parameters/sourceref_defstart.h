@@ -4,9 +4,19 @@
 #define SOURCE_TYPE																                        \
 		ParamSetBySourceType source_type = PARAM_VALUE_IS_SET_BY_APPLICATION
 
+#if PARAMETERS_TRACK_CALL_SITES
+#define CALL_SITE_REF																                    \
+		, const std::source_location &call_site = std::source_location::current()
+#define CALL_SITE_REF_ONLY															                    \
+		const std::source_location &call_site = std::source_location::current()
+#else
+#define CALL_SITE_REF
+#define CALL_SITE_REF_ONLY
+#endif
+
 #define SOURCE_REF																                        \
 		ParamSetBySourceType source_type = PARAM_VALUE_IS_SET_BY_APPLICATION,							\
-		ParamPtr source = nullptr
+		ParamPtr source = nullptr CALL_SITE_REF
 
 #define THE_4_HANDLERS_PROTO																			\
       ParamOnModifyFunction on_modify_f = 0, ParamOnValidateFunction on_validate_f = 0,					\
@@ -8,8 +8,9 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <string>
-#include <vector>
+#include <unordered_set>
 
 namespace parameters {
 
@@ -40,6 +41,13 @@ namespace parameters {
 
 		FILE * operator()() const;
 
+		// Switch to asynchronous output: from now on, the buffered report content is handed off to a background thread,
+		// which writes it to the file while the report producer continues filling a second buffer (double buffering).
+		// The output order is retained, while Finalize() waits for the background thread to complete writing and closing the file.
+		//
+		// Does nothing when no output file has been opened.
+		void EnableAsyncOutput();
+
 		operator bool() const {
 			return _f != nullptr;
 		};
@@ -55,10 +63,13 @@ namespace parameters {
 		std::string _canonical_filepath;
 		bool _errored;
 
-		// We assume we won't be processing very many file paths through here, so a linear scan through
-		// the set-processed-to-date is considered good enough/best re performance, hence std::vector 
-		// sufices for the tracking list.
-		static std::vector<std::string> _processed_file_paths;
+		// the background writer, when operating in async mode.
+		struct AsyncDrain;
+		std::unique_ptr<AsyncDrain> _async;
+
+		// The (case-insensitive, hence lowercased) file paths written to thus far, so we know whether to overwrite or append.
+		// Guarded by a mutex as reports may be produced by multiple threads.
+		static std::unordered_set<std::string> _processed_file_paths;
 	};
 
 }
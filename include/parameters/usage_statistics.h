@@ -0,0 +1,127 @@
+
+#ifndef _LIB_PARAMS_USAGE_STATISTICS_H_
+#define _LIB_PARAMS_USAGE_STATISTICS_H_
+
+#include <parameters/parameter_classes.h>
+#include <parameters/parameter_sets.h>
+#include <parameters/reportwriter.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+
+namespace parameters {
+
+	// --------------------------------------------------------------------------------------------------
+
+	// Binary usage statistics dumps, et al, used to collect parameter usage statistics across many runs (processes)
+	// of the same application: each run writes a compact binary dump, while UsageStatsAggregate merges any number of
+	// those dumps into a single usage report, without the need to parse any (markdown) text reports.
+	//
+	// File layout: a 32 byte header (see below), followed by `record_count` records of `record_size` bytes each (see UsageStatsRecord),
+	// followed by the names arena: the normalized parameter names (lowercase, '-' replaced by '_'), NUL-terminated.
+	// All values are stored little-endian.
+
+	struct UsageStatsDumpHeader {
+		char magic[4];                  // "PUSD"
+		uint16_t version;               // format version; currently 1.
+		uint16_t record_size;           // sizeof(UsageStatsRecord)
+		uint32_t record_count;
+		uint32_t names_size;
+		uint64_t schema_fingerprint;    // Snapshot::SchemaFingerprint() of the parameter set the dump was produced from
+		int64_t timestamp;              // time of the dump, in seconds since the epoch
+	};
+	static_assert(sizeof(UsageStatsDumpHeader) == 32);
+
+	enum UsageStatsFlags : uint8_t {
+		USAGESTATS_IS_INIT = 0x01,
+		USAGESTATS_IS_DEBUG = 0x02,
+		USAGESTATS_IS_NON_DEFAULT = 0x04,
+		USAGESTATS_HAS_FAULTED = 0x08,
+	};
+
+	struct UsageStatsRecord {
+		uint64_t name_hash;             // FNV-1a hash of the normalized parameter name; identifies the parameter across runs
+		uint32_t name_offset;           // offset of the (NUL-terminated) normalized name in the names arena
+		uint16_t type;                  // ParamType
+		uint8_t set_mode;               // ParamSetBySourceType
+		uint8_t flags;                  // UsageStatsFlags
+
+		// the access counts for the entire run, i.e. the totals of all sections, including the current one.
+		uint64_t reading;
+		uint64_t writing;
+		uint64_t changing;
+		uint64_t faulting;
+	};
+	static_assert(sizeof(UsageStatsRecord) == 48);
+
+	class UsageStatsDump {
+	public:
+		// Write the usage statistics of all parameters in the given set to a binary dump file. Returns false on (I/O) error.
+		static bool Write(const char *path, const ParamsVectorSet &set);
+		static bool Write(const std::string &path, const ParamsVectorSet &set) {
+			return Write(path.c_str(), set);
+		}
+
+		// Register the given set for a dump at application exit (via atexit()). Any subsequent call replaces the registered path and set.
+		//
+		// The parameter set must remain valid until then.
+		static void WriteAtExit(const char *path, const ParamsVectorSet &set);
+	};
+
+	// Merge any number of binary usage statistics dumps into a combined usage report.
+	class UsageStatsAggregate {
+	public:
+		struct Entry {
+			std::string name;
+			ParamType type = UNKNOWN_PARAM;
+			uint8_t flags = 0;              // UsageStatsFlags, OR-ed across all runs
+			uint32_t set_modes = 0;         // bit mask of the ParamSetBySourceType modes seen across all runs
+
+			// the number of runs which carried the parameter, resp. read, wrote, changed it or signaled a fault.
+			uint32_t runs = 0;
+			uint32_t runs_reading = 0;
+			uint32_t runs_writing = 0;
+			uint32_t runs_changing = 0;
+			uint32_t runs_faulting = 0;
+
+			// the access counts, summed across all runs.
+			uint64_t reading = 0;
+			uint64_t writing = 0;
+			uint64_t changing = 0;
+			uint64_t faulting = 0;
+		};
+
+		UsageStatsAggregate();
+
+		// Merge the given dump file. Returns false when the file cannot be loaded; see error_message() for details.
+		bool Merge(const char *path);
+		bool Merge(const std::string &path) {
+			return Merge(path.c_str());
+		}
+
+		// The number of dumps merged thus far.
+		size_t run_count() const noexcept;
+		// The number of dumps which failed to load.
+		size_t failed_count() const noexcept;
+
+		const std::string &error_message() const noexcept;
+
+		const std::unordered_map<uint64_t, Entry> &entries() const noexcept;
+
+		// Produce the combined usage report: the parameters which have been read in any run, followed by the ones which were never read
+		// when `report_unused_params` is set.
+		void Report(ReportWriter &dst, bool report_unused_params = true, const char *section_title = nullptr) const;
+
+	protected:
+		std::unordered_map<uint64_t, Entry> entries_;
+		size_t runs_;
+		size_t failed_;
+		std::string errmsg_;
+		std::string file_buffer_;       // reused across Merge() calls
+	};
+
+} // namespace
+
+#endif
@@ -34,6 +34,9 @@ namespace parameters {
 		//
 		// Variable names are followed by one of more whitespace characters,
 		// followed by the Value, which spans the rest of line.
+		//
+		// Numeric array parameters (IntSetParam, DoubleSetParam) also accept a Value of the form
+		// `@/path/to/file`, which loads the array from a binary blob file (see BinaryBlobFile).
 		static bool ReadParamsFile(ConfigReader &fp, const ParamsVectorSet &set, SurplusParamsVector *surplus, SOURCE_REF);
 
 		/**
@@ -57,6 +60,11 @@ namespace parameters {
 		static void SetApplicationName(const char *appname = nullptr);
 		static const std::string &GetApplicationName();
 
+		// The cheap, coarse monotonic clock used for the parameter access timestamps (see Param::track_access_times()):
+		// produces the number of nanoseconds since application start. The resolution is platform dependent and may be
+		// as coarse as a few milliseconds.
+		static uint64_t AccessClockNow() noexcept;
+
 		// Set a parameter to have the given value.
 		template <ParamAcceptableValueType T>
 		static bool SetParam(
@@ -140,8 +148,34 @@ namespace parameters {
 		// When `f` is a valid handle, then the report is written to the given FILE,
 		// which may be stdout/stderr.
 		//
+		// When `report_unused_params` is TRUE (the default), the report also lists the parameters which have not been read,
+		// both for the lump sum and the section reports. That list requires a scan of all parameters, while the list of used
+		// parameters in a section report only costs as much as the number of parameters touched during that section
+		// (see ParamsVector::touched_list()); set it to FALSE to skip the unused list.
+		//
 		// When `set` is empty, the `GlobalParams()` vector will be assumed instead.
-		static void ReportParamsUsageStatistics(ReportWriter &dst, const ParamsVectorSet &set, int section_level, bool report_unused_params = false, ReportWriter::ParamInfoElement show_elements_style = ReportWriter::PARAMINFO_EXPLANATORY_STATUSREPORT_LINE, const char *section_title = nullptr);
+		static void ReportParamsUsageStatistics(ReportWriter &dst, const ParamsVectorSet &set, int section_level, bool report_unused_params = true, ReportWriter::ParamInfoElement show_elements_style = ReportWriter::PARAMINFO_EXPLANATORY_STATUSREPORT_LINE, const char *section_title = nullptr);
+
+		// Report the `top_k` most frequently read parameters in the set, ranked by their number of reads in the current section plus
+		// the sections recorded in the section history (see ParamsVector::set_section_history_depth()), busiest first.
+		//
+		// Each entry carries an estimate of the time spent in the value() calls, based on a one-time calibration of the read cost per
+		// parameter type, and is flagged as a caching candidate when it has been read at least `hot_read_threshold` times in a section
+		// without ever changing in any such section: those reads can be hoisted into a local variable.
+		//
+		// Unlike ReportParamsUsageStatistics(), this report does not reset the access counters.
+		static void ReportHotParams(ReportWriter &dst, const ParamsVectorSet &set, size_t top_k = 20, uint32_t hot_read_threshold = 1000, const char *section_title = nullptr);
+
+		// Report the `top_k` most expensive event handlers in the set, ranked by their cumulative latency: each entry lists the
+		// parameter, the handler kind, the number of calls and the cumulative, average and maximum latency.
+		// Only the parameters for which handler timings are tracked are considered; see Param::track_handler_timings().
+		static void ReportHandlerTimings(ReportWriter &dst, const ParamsVectorSet &set, size_t top_k = 20, const char *section_title = nullptr);
+
+#if PARAMETERS_TRACK_CALL_SITES
+		// Report the (at most) `max_sites_per_param` busiest call sites of each parameter in the set which has recorded any,
+		// busiest first. See Param::call_sites().
+		static void ReportParamCallSites(ReportWriter &dst, const ParamsVectorSet &set, size_t max_sites_per_param = 5, const char *section_title = nullptr);
+#endif
 
 		// --------------------------------------------------------------------------------------------------
 
@@ -184,24 +218,24 @@ namespace parameters {
 	bool ParamUtils::SetParam<int32_t>(
 			const char *name, const int32_t value,
 			const ParamsVectorSet &set,
-			ParamSetBySourceType source_type, ParamPtr source);
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM);
 	template <>
 	bool ParamUtils::SetParam<bool>(
 			const char *name, const bool value,
 			const ParamsVectorSet &set,
-			ParamSetBySourceType source_type, ParamPtr source);
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM);
 	template <>
 	bool ParamUtils::SetParam<double>(
 			const char *name, const double value,
 			const ParamsVectorSet &set,
-			ParamSetBySourceType source_type, ParamPtr source);
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM);
 	template <ParamAcceptableValueType T>
 	bool ParamUtils::SetParam(
 			const char *name, const T value,
 			ParamsVector &set,
-			ParamSetBySourceType source_type, ParamPtr source) {
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		ParamsVectorSet pvec({&set});
-		return SetParam<T>(name, value, pvec, source_type, source);
+		return SetParam<T>(name, value, pvec, source_type, source PARAM_CALL_SITE_ARG);
 	}
 
 	// --------------------------------------------------------------------------------------------------
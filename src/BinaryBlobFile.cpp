@@ -0,0 +1,181 @@
+
+#include <parameters/parameters.h>
+
+#include "internal_helpers.hpp"
+#include "logchannel_helpers.hpp"
+#include "os_platform_helpers.hpp"
+
+
+namespace parameters {
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// BinaryBlobFile
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	static const char blob_magic[4] = {'P', 'B', 'L', 'B'};
+	static const uint16_t blob_format_version = 1;
+
+	// The on-disk format is little-endian; big-endian hosts byte-swap the values after reading them.
+	// (see from_little_endian())
+
+	BinaryBlobFile::BinaryBlobFile(const char *path)
+		: _file(nullptr)
+		, _header()
+	{
+		open(path);
+	}
+
+	BinaryBlobFile::BinaryBlobFile(const std::string &path)
+		: BinaryBlobFile(path.c_str())
+	{}
+
+	BinaryBlobFile::~BinaryBlobFile() {
+		close();
+	}
+
+	void BinaryBlobFile::open(const char *path) {
+		if (!path || !*path) {
+			_errmsg = "no binary blob file path specified";
+			return;
+		}
+
+		fs::path p = fs::weakly_canonical(path);
+		std::u8string p8 = p.u8string();
+		_path = reinterpret_cast<const char *>(p8.c_str());
+
+		std::error_code ec;
+		uintmax_t file_size = fs::file_size(p, ec);
+		if (ec) {
+			_errmsg = fmt::format("cannot obtain the size of binary blob file '{}': {}", _path, ec.message());
+			return;
+		}
+		if (file_size < sizeof(BinaryBlobHeader)) {
+			_errmsg = fmt::format("binary blob file '{}' is too small ({} bytes) to be a valid blob file", _path, file_size);
+			return;
+		}
+
+		_file = fopen(_path.c_str(), "rb");
+		if (!_file) {
+			_errmsg = fmt::format("cannot open binary blob file '{}': {}", _path, strerror(errno));
+			return;
+		}
+		if (fread(&_header, sizeof(_header), 1, _file) != 1) {
+			_errmsg = fmt::format("cannot read the header of binary blob file '{}': {}", _path, strerror(errno));
+			close();
+			return;
+		}
+		_header.version = from_little_endian(_header.version);
+		_header.element_type = from_little_endian(_header.element_type);
+		_header.element_size = from_little_endian(_header.element_size);
+		_header.reserved = from_little_endian(_header.reserved);
+		_header.element_count = from_little_endian(_header.element_count);
+
+		if (0 != memcmp(_header.magic, blob_magic, sizeof(blob_magic))) {
+			_errmsg = fmt::format("file '{}' is not a binary blob file: header magic mismatch", _path);
+		} else if (_header.version != blob_format_version) {
+			_errmsg = fmt::format("binary blob file '{}' has unsupported format version {}; we support version {}", _path, _header.version, blob_format_version);
+		} else if (!(_header.element_type == INT_PARAM && _header.element_size == sizeof(int32_t)) && !(_header.element_type == DOUBLE_PARAM && _header.element_size == sizeof(double))) {
+			_errmsg = fmt::format("binary blob file '{}' carries an unsupported element type/size combo ({}/{})", _path, _header.element_type, _header.element_size);
+		} else if (_header.element_count > (file_size - sizeof(BinaryBlobHeader)) / _header.element_size) {
+			_errmsg = fmt::format("binary blob file '{}' is truncated: header announces {} elements, while the file only carries {} bytes of array data", _path, _header.element_count, file_size - sizeof(BinaryBlobHeader));
+		} else {
+			return;
+		}
+		close();
+	}
+
+	void BinaryBlobFile::close() {
+		if (_file) {
+			fclose(_file);
+			_file = nullptr;
+		}
+	}
+
+	const std::string &BinaryBlobFile::error_message() const {
+		return _errmsg;
+	}
+
+	ParamType BinaryBlobFile::element_type() const {
+		return _file ? ParamType(_header.element_type) : UNKNOWN_PARAM;
+	}
+
+	size_t BinaryBlobFile::element_count() const {
+		return _file ? size_t(_header.element_count) : 0;
+	}
+
+	// read the array with a single bulk fread; `dst` is only replaced once the read has succeeded.
+	template <class T>
+	static inline bool read_blob_array(std::vector<T> &dst, FILE *f, size_t count, const std::string &path) {
+		std::vector<T> v(count);
+		if (count > 0) {
+			if (fseek(f, long(sizeof(BinaryBlobHeader)), SEEK_SET) != 0 || fread(v.data(), sizeof(T), count, f) != count) {
+				PARAM_ERROR("Failed to read the array data from binary blob file '{}': {}\n", path, strerror(errno));
+				return false;
+			}
+			if constexpr (std::endian::native != std::endian::little) {
+				for (T &e : v) {
+					e = from_little_endian(e);
+				}
+			}
+		}
+		dst = std::move(v);
+		return true;
+	}
+
+	bool BinaryBlobFile::get(std::vector<int32_t> &dst) const {
+		if (element_type() != INT_PARAM)
+			return false;
+		return read_blob_array(dst, _file, element_count(), _path);
+	}
+
+	bool BinaryBlobFile::get(std::vector<double> &dst) const {
+		if (element_type() != DOUBLE_PARAM)
+			return false;
+		return read_blob_array(dst, _file, element_count(), _path);
+	}
+
+	template <class T>
+	static bool write_blob_file(const char *path, const std::vector<T> &src, ParamType element_type) {
+		BinaryBlobHeader hdr;
+		memcpy(hdr.magic, blob_magic, sizeof(blob_magic));
+		hdr.version = from_little_endian(blob_format_version);
+		hdr.element_type = from_little_endian(uint16_t(element_type));
+		hdr.element_size = from_little_endian(uint32_t(sizeof(T)));
+		hdr.reserved = 0;
+		hdr.element_count = from_little_endian(uint64_t(src.size()));
+
+		FILE *f = fopen(path, "wb");
+		if (!f) {
+			PARAM_ERROR("Cannot produce binary blob file: {}: {}\n", path, strerror(errno));
+			return false;
+		}
+		bool good = (fwrite(&hdr, sizeof(hdr), 1, f) == 1);
+		if (good && !src.empty()) {
+			if constexpr (std::endian::native == std::endian::little) {
+				good = (fwrite(src.data(), sizeof(T), src.size(), f) == src.size());
+			} else {
+				for (size_t i = 0; good && i < src.size(); i++) {
+					T v = from_little_endian(src[i]);
+					good = (fwrite(&v, sizeof(T), 1, f) == 1);
+				}
+			}
+		}
+		if (fclose(f) != 0)
+			good = false;
+		if (!good) {
+			PARAM_ERROR("Failed to write binary blob file '{}': {}\n", path, strerror(errno));
+		}
+		return good;
+	}
+
+	bool BinaryBlobFile::Write(const char *path, const std::vector<int32_t> &src) {
+		return write_blob_file(path, src, INT_PARAM);
+	}
+
+	bool BinaryBlobFile::Write(const char *path, const std::vector<double> &src) {
+		return write_blob_file(path, src, DOUBLE_PARAM);
+	}
+
+}	// namespace
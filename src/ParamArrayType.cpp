@@ -5,8 +5,299 @@
 #include "logchannel_helpers.hpp"
 #include "os_platform_helpers.hpp"
 
+#include <algorithm>
+
 
 namespace parameters {
 
+#include <parameters/sourceref_defstart.h>
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// BasicVectorTypedParam :: element-level edits
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::report_edit_out_of_range(size_t index) {
+		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
+		count_access(access_counts_.writing);
+		reset_fault();
+		fault();
+		PARAM_ERROR("ERROR: error editing {} parameter '{}': element index {} is out of range as the array has {} elements. The parameter value will not be adjusted.\n", ParamUtils::GetApplicationName(), name_str(), index, value_.size());
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::splice_value(size_t offset, size_t count, VecT &&replacement, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		if (offset > value_.size()) {
+			report_edit_out_of_range(offset);
+			return;
+		}
+		count = std::min(count, value_.size() - offset);
+
+		if (!on_validate_f_is_default_ || !on_modify_f_is_default_) {
+			// The user-defined handlers expect to see the complete old and new array values, so we have to produce a full copy.
+			// set_value() takes care of all the accounting for us.
+			VecT value;
+			value.reserve(value_.size() - count + replacement.size());
+			value.insert(value.end(), value_.begin(), value_.begin() + offset);
+			value.insert(value.end(), std::make_move_iterator(replacement.begin()), std::make_move_iterator(replacement.end()));
+			value.insert(value.end(), value_.begin() + offset + count, value_.end());
+			set_value(value, source_type, source PARAM_CALL_SITE_ARG);
+			return;
+		}
+
+		// Fast path: the default validate and modify handlers don't do anything, so we can edit in place,
+		// while we only have to compare the edited range to detect an actual change.
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
+		reset_fault();
+
+		set_ = (source_type > PARAM_VALUE_IS_RESET);
+
+		auto first = value_.begin() + offset;
+		if (replacement.size() == count && std::equal(replacement.begin(), replacement.end(), first))
+			return;
+
+		// For a same-sized edit of a same-sized array, the differences with the default value can be tracked incrementally,
+		// provided we know the number of differences before the edit: that is trivially zero while we're at the default value.
+		const bool same_size_edit = (replacement.size() == count && value_.size() == default_.size());
+		bool diff_count_known = false;
+		if (same_size_edit) {
+			if (!set_to_non_default_value_) {
+				default_diff_count_ = 0;
+				diff_count_known = true;
+			} else {
+				diff_count_known = (default_diff_version_ == version_);
+			}
+			if (diff_count_known)
+				default_diff_count_ -= count_default_diffs(offset, count);
+		}
+
+		note_value_change();
+		count_access(access_counts_.changing);
+		if (replacement.size() == count) {
+			std::move(replacement.begin(), replacement.end(), first);
+		} else if (replacement.size() > count) {
+			std::move(replacement.begin(), replacement.begin() + count, first);
+			value_.insert(first + count, std::make_move_iterator(replacement.begin() + count), std::make_move_iterator(replacement.end()));
+		} else {
+			std::move(replacement.begin(), replacement.end(), first);
+			value_.erase(first + replacement.size(), first + count);
+		}
+
+		// A different-sized array is never at the default value. Otherwise, update the number of differences for the edited range,
+		// or establish it once with a full comparison when we don't know it (yet): subsequent edits then only cost O(edit) again.
+		if (value_.size() != default_.size()) {
+			set_to_non_default_value_ = true;
+			return;
+		}
+		if (diff_count_known)
+			default_diff_count_ += count_default_diffs(offset, count);
+		else
+			default_diff_count_ = count_default_diffs(0, value_.size());
+		default_diff_version_ = version_;
+		set_to_non_default_value_ = (default_diff_count_ != 0);
+	}
+
+	template <class ElemT, class Assistant>
+	size_t BasicVectorTypedParam<ElemT, Assistant>::count_default_diffs(size_t offset, size_t count) const {
+		DEBUG_ASSERT(value_.size() == default_.size());
+		size_t n = 0;
+		for (size_t i = offset, end = offset + count; i < end; i++) {
+			n += (value_[i] != default_[i]);
+		}
+		return n;
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::push_back(const ElemT &v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		splice_value(value_.size(), 0, VecT(1, v), source_type, source PARAM_CALL_SITE_ARG);
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::erase(size_t index, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		if (index >= value_.size()) {
+			report_edit_out_of_range(index);
+			return;
+		}
+		splice_value(index, 1, VecT(), source_type, source PARAM_CALL_SITE_ARG);
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::set_element(size_t index, const ElemT &v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		if (index >= value_.size()) {
+			report_edit_out_of_range(index);
+			return;
+		}
+		splice_value(index, 1, VecT(1, v), source_type, source PARAM_CALL_SITE_ARG);
+	}
+
+	template <class ElemT, class Assistant>
+	typename BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit BasicVectorTypedParam<ElemT, Assistant>::edit(size_t offset, size_t count, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		return ScopedEdit(*this, offset, count, source_type, source PARAM_CALL_SITE_ARG);
+	}
+
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit::ScopedEdit(RTP &param, size_t offset, size_t count, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM)
+		: param_(&param),
+		offset_(offset),
+		count_(0),
+		source_type_(source_type),
+		source_(source)
+#if PARAMETERS_TRACK_CALL_SITES
+		, call_site_(call_site)
+#endif
+	{
+		// we're about to look at the current value, so this counts as a read.
+		const VecT &value = param.value(PARAM_CALL_SITE_ONLY_ARG);
+		if (offset <= value.size()) {
+			count_ = std::min(count, value.size() - offset);
+			slice_.assign(value.begin() + offset, value.begin() + offset + count_);
+		}
+		// else: out of range, which will be reported when the edit is committed.
+	}
+
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit::ScopedEdit(ScopedEdit &&o) noexcept
+		: param_(o.param_),
+		offset_(o.offset_),
+		count_(o.count_),
+		slice_(std::move(o.slice_)),
+		source_type_(o.source_type_),
+		source_(o.source_)
+#if PARAMETERS_TRACK_CALL_SITES
+		, call_site_(o.call_site_)
+#endif
+	{
+		o.param_ = nullptr;
+	}
+
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit::~ScopedEdit() {
+		// Destructors are noexcept, while the validate/modify handlers invoked by the commit may throw: a failed implicit commit
+		// is signaled as a (recoverable) fault of the parameter instead. Use an explicit commit() to receive the exception.
+		RTP *param = param_;
+		try {
+			commit();
+		} catch (const std::exception &ex) {
+			param->fault();
+			PARAM_ERROR("ERROR: error committing the edit of {} parameter '{}': {}. The parameter value may not have been adjusted.\n", ParamUtils::GetApplicationName(), param->name_str(), ex.what());
+		} catch (...) {
+			param->fault();
+			PARAM_ERROR("ERROR: error committing the edit of {} parameter '{}': unknown exception. The parameter value may not have been adjusted.\n", ParamUtils::GetApplicationName(), param->name_str());
+		}
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit::commit() {
+		if (param_ == nullptr)
+			return;
+		RTP *param = param_;
+		param_ = nullptr;
+#if PARAMETERS_TRACK_CALL_SITES
+		param->splice_value(offset_, count_, std::move(slice_), source_type_, source_, call_site_);
+#else
+		param->splice_value(offset_, count_, std::move(slice_), source_type_, source_);
+#endif
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::ScopedEdit::cancel() noexcept {
+		param_ = nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// BasicVectorTypedParam :: assistant & parse cache
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <class ElemT, class Assistant>
+	Assistant &BasicVectorTypedParam<ElemT, Assistant>::get_assistant() {
+		// the caller may change the parse rules through this reference, so any cached parse result cannot be trusted any more.
+		invalidate_parse_cache();
+		return assistant_;
+	}
+
+	template <class ElemT, class Assistant>
+	const Assistant &BasicVectorTypedParam<ElemT, Assistant>::get_assistant() const {
+		return assistant_;
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::enable_parse_cache(bool enable) {
+		if (!enable)
+			parse_cache_.reset();
+		else if (!parse_cache_)
+			parse_cache_.reset(new ParseCache());
+	}
+
+	template <class ElemT, class Assistant>
+	bool BasicVectorTypedParam<ElemT, Assistant>::has_parse_cache() const noexcept {
+		return !!parse_cache_;
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::invalidate_parse_cache() noexcept {
+		if (parse_cache_) {
+			parse_cache_->valid = false;
+		}
+	}
+
+	// A `@/path/to/file` value references a binary blob file, whose content may change between loads: the parse result
+	// of such a value depends on more than the input string, so these are never served from (or stored in) the parse cache.
+	static bool is_blob_file_reference(const std::string &input) {
+		size_t pos = input.find_first_not_of(" \t\r\n\f\v");
+		return pos != std::string::npos && input[pos] == '@';
+	}
+
+	template <class ElemT, class Assistant>
+	const typename BasicVectorTypedParam<ElemT, Assistant>::VecT *BasicVectorTypedParam<ElemT, Assistant>::parse_cache_lookup(const std::string &input, ParamSetBySourceType source_type) const {
+		if (!parse_cache_ || !parse_cache_->valid || parse_cache_->source_type != source_type)
+			return nullptr;
+		// std::string's comparison checks the sizes first, so a mismatch is usually detected without touching the content.
+		// Blob file references never match, as parse_cache_store() doesn't store them.
+		if (parse_cache_->input != input)
+			return nullptr;
+		return &parse_cache_->value;
+	}
+
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::parse_cache_store(const std::string &input, ParamSetBySourceType source_type, const VecT &value) {
+		if (!parse_cache_ || is_blob_file_reference(input))
+			return;
+		parse_cache_->input = input;
+		parse_cache_->source_type = source_type;
+		parse_cache_->value = value;
+		parse_cache_->valid = true;
+	}
+
+	// The parameter types which are actually available in this library:
+
+#define INSTANTIATE_VECTOR_PARAM_GENERICS(ElemT)																							\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::report_edit_out_of_range(size_t);								\
+	template size_t BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::count_default_diffs(size_t, size_t) const;					\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::splice_value(size_t, size_t, std::vector<ElemT> &&, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::push_back(const ElemT &, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE);		\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::erase(size_t, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE);					\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_element(size_t, const ElemT &, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE); \
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ScopedEdit BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::edit(size_t, size_t, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE); \
+	template BasicVectorParamParseAssistant &BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::get_assistant();				\
+	template const BasicVectorParamParseAssistant &BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::get_assistant() const;	\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::enable_parse_cache(bool);								\
+	template bool BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::has_parse_cache() const noexcept;						\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::invalidate_parse_cache() noexcept;						\
+	template const std::vector<ElemT> *BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::parse_cache_lookup(const std::string &, ParamSetBySourceType) const; \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::parse_cache_store(const std::string &, ParamSetBySourceType, const std::vector<ElemT> &); \
+	template class BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ScopedEdit
+
+	INSTANTIATE_VECTOR_PARAM_GENERICS(bool);
+	INSTANTIATE_VECTOR_PARAM_GENERICS(int32_t);
+	INSTANTIATE_VECTOR_PARAM_GENERICS(double);
+	INSTANTIATE_VECTOR_PARAM_GENERICS(std::string);
+
+#undef INSTANTIATE_VECTOR_PARAM_GENERICS
+
+#include <parameters/sourceref_defend.h>
 
 } // namespace tesseract
@@ -12,41 +12,192 @@ namespace parameters {
 
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////
 	//
-	// IntSetParam
+	// shared helpers
 	//
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void IntSetParam_ParamOnModifyFunction(IntSetParam &target, const std::vector<int32_t> &old_value, std::vector<int32_t> &new_value, const std::vector<int32_t> &default_value, ParamSetBySourceType source_type, ParamPtr optional_setter) {
+	// Check whether the value string references a binary blob file (`@/path/to/file`) and, if so, load the array from that file.
+	//
+	// Returns false when the value string is NOT a blob file reference, i.e. when the regular text parser should take over.
+	// Returns true when the reference has been processed; any failure to load the file will have been reported and signaled via fault().
+	template <class ParamT, class ElemT>
+	static bool parse_binary_blob_reference(ParamT &target, std::vector<ElemT> &new_value, const std::string &source_value_str, unsigned int &pos) {
+		const char *s = source_value_str.c_str();
+		while (isspace(*s))
+			s++;
+		if (*s != '@')
+			return false;
+		s++;
+		while (isspace(*s))
+			s++;
+		std::string path(s);
+		while (!path.empty() && isspace(path.back()))
+			path.pop_back();
+
+		BinaryBlobFile blob(path);
+		if (blob && blob.get(new_value)) {
+			pos = source_value_str.size();
+			return true;
+		}
+
+		std::string errmsg;
+		if (blob && blob.element_type() == (std::is_same_v<ElemT, double> ? DOUBLE_PARAM : INT_PARAM)) {
+			errmsg = "the array data could not be read from the binary blob file";
+		} else if (blob) {
+			errmsg = fmt::format("the binary blob file carries an array of {} values, which does not match the parameter type", blob.element_type() == INT_PARAM ? "integer" : "floating point");
+		} else {
+			errmsg = blob.error_message();
+		}
+		target.fault();
+		PARAM_ERROR("ERROR: error loading {} parameter '{}' value (\"{}\") to {}; {}. The parameter value will not be adjusted: the preset value ({}) will be used instead.\n", ParamUtils::GetApplicationName(), target.name_str(), source_value_str, target.value_type_str(), errmsg, target.formatted_value_str());
+		pos = 0;
+		return true;
+	}
+
+	// The element type specifics of the numeric set parameters (IntSetParam, DoubleSetParam, BoolSetParam): everything else,
+	// from the list parser to the handler plumbing, is shared by these types, see the NumberSetParam_* templates below.
+	template <class ElemT>
+	struct NumberSetElementTraits;
+
+	template <>
+	struct NumberSetElementTraits<int32_t> {
+		static constexpr ParamType param_type = INT_SET_PARAM;
+		static constexpr bool supports_blob_files = true;
+		static constexpr const char *type_info_4_inspect = "Int32Array";
+		static constexpr const char *type_info_4_display = "set of integers";
+		static constexpr const char *accepted_values_info = "";
+
+		// IntParam_ParamOnParseFunction(...) derivative chunk, parsing a single integer.
+		//
+		// Returns true on success. On failure, `ec` carries the errno-style error code (E_OK when the parser simply didn't consume
+		// the entire element) and `endptr` points at the spot where the parser stopped.
+		static bool parse_element(const char *s, const char *&endptr, int32_t &val, int &ec) {
+			char *ep = nullptr;
+			// https://stackoverflow.com/questions/25315191/need-to-clean-up-errno-before-calling-function-then-checking-errno?rq=3
+			clear_errno();
+			auto parsed_value = strtol(s, &ep, 10);
+			ec = errno;
+			val = int32_t(parsed_value);
+			endptr = (ep ? ep : s);
+			bool good = (ep != nullptr && ec == E_OK);
+			if (good) {
+				// check to make sure the tail is legal: all whitespace has been stripped already, so the tail must be empty!
+				// This also takes care of utter parse failure (when not already signaled via `errno`) when strtol() returns 0 and sets `endptr == s`.
+				good = (*ep == '\0');
+
+				// check if our parsed value is out of legal range: we check the type conversion as that is faster than checking against [INT32_MIN, INT32_MAX].
+				if (val != parsed_value && ec == E_OK) {
+					good = false;
+					ec = ERANGE;
+				}
+			}
+			return good;
+		}
+
+		static std::string range_error_info() {
+			return fmt::format("an integer value overflow (ERANGE); we accept decimal values between {} and {}.", std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+		}
+	};
+
+	template <>
+	struct NumberSetElementTraits<double> {
+		static constexpr ParamType param_type = DOUBLE_SET_PARAM;
+		static constexpr bool supports_blob_files = true;
+		static constexpr const char *type_info_4_inspect = "DoubleArray";
+		static constexpr const char *type_info_4_display = "set of floating point values";
+		static constexpr const char *accepted_values_info = "";
+
+		// DoubleParam_ParamOnParseFunction(...) derivative chunk, parsing a single floating point value.
+		static bool parse_element(const char *s, const char *&endptr, double &val, int &ec) {
+			char *ep = nullptr;
+			clear_errno();
+			val = strtod(s, &ep);
+			ec = errno;
+			endptr = (ep ? ep : s);
+			bool good = (ep != nullptr && ep != s && ec == E_OK);
+			if (good) {
+				// check to make sure the tail is legal: all whitespace has been stripped already, so the tail must be empty!
+				good = (*ep == '\0');
+
+				// check if our parsed value is out of legal range:
+				if (!is_legal_fpval(val) && ec == E_OK) {
+					good = false;
+					ec = ERANGE;
+				}
+			}
+			return good;
+		}
+
+		static std::string range_error_info() {
+			return fmt::format("a floating point value overflow (ERANGE); we accept floating point values between {} and {}.", std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max());
+		}
+	};
+
+	template <>
+	struct NumberSetElementTraits<bool> {
+		static constexpr ParamType param_type = BOOL_SET_PARAM;
+		// BinaryBlobFile only carries int32 and double arrays.
+		static constexpr bool supports_blob_files = false;
+		static constexpr const char *type_info_4_inspect = "BoolArray";
+		static constexpr const char *type_info_4_display = "set of booleans";
+		static constexpr const char *accepted_values_info = "; we accept boolean words ([T]rue/[F]alse/[Y]es/[J]a/[N]o), boolean symbols (+/-/./x) and numbers";
+
+		// BoolParam_ParamOnParseFunction(...) derivative chunk, parsing a single boolean value.
+		static bool parse_element(const char *s, const char *&endptr, bool &val, int &ec) {
+			ec = parse_boolean_value(s, endptr, val);
+			if (ec == E_OK)
+				return true;
+			// anything but a numeric overflow is reported via `endptr`, i.e. as a partial or utter parse failure.
+			if (ec != ERANGE)
+				ec = E_OK;
+			return false;
+		}
+
+		static std::string range_error_info() {
+			return fmt::format("an integer value overflow (ERANGE); while we expect a boolean value (ideally 1/0/-1), we accept decimal values between {} and {} where any non-zero value equals TRUE.", std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// IntSetParam, DoubleSetParam, BoolSetParam
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	template <class ElemT>
+	void NumberSetParam_ParamOnModifyFunction(BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant> &target, const std::vector<ElemT> &old_value, std::vector<ElemT> &new_value, const std::vector<ElemT> &default_value, ParamSetBySourceType source_type, ParamPtr optional_setter) {
 		// nothing to do
 		return;
 	}
 
-	void IntSetParam_ParamOnValidateFunction(IntSetParam &target, const std::vector<int32_t> &old_value, std::vector<int32_t> &new_value, const std::vector<int32_t> &default_value, ParamSetBySourceType source_type) {
+	template <class ElemT>
+	void NumberSetParam_ParamOnValidateFunction(BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant> &target, const std::vector<ElemT> &old_value, std::vector<ElemT> &new_value, const std::vector<ElemT> &default_value, ParamSetBySourceType source_type) {
 		// nothing to do
 		return;
 	}
 
-	void IntSetParam_ParamOnParseFunction(IntSetParam &target, std::vector<int32_t> &new_value, const std::string &source_value_str, unsigned int &pos, ParamSetBySourceType source_type) {
-		const BasicVectorParamParseAssistant &assistant = target.get_assistant();
+	template <class ElemT>
+	void NumberSetParam_ParamOnParseFunction(BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant> &target, std::vector<ElemT> &new_value, const std::string &source_value_str, unsigned int &pos, ParamSetBySourceType source_type) {
+		using Traits = NumberSetElementTraits<ElemT>;
 
-		// create a modifiable copy of the `source_value_str`; we use a small-strings optimization approach similar to std::string internally.
-		const char *svs = source_value_str.c_str();
-		const int MAX_SMALLSIZE = 1022;
-		char small_buf[MAX_SMALLSIZE + 2];
-		const auto slen = strlen(svs);
-		char *vs;
-		// the std::unique_ptr ensures this heap space is properly released at end of scope, no matter what happens next in this code.
-		std::unique_ptr<char> vs_dropper;
-		if (slen <= MAX_SMALLSIZE) {
-			vs = small_buf;
-		} else {
-			vs_dropper.reset(new char[slen + 2]);
-			vs = vs_dropper.get();
+		// `@path` value strings load the array straight from a binary blob file: no text parsing involved.
+		if constexpr (Traits::supports_blob_files) {
+			if (parse_binary_blob_reference(target, new_value, source_value_str, pos))
+				return;
 		}
+
+		const BasicVectorParamParseAssistant &assistant = target.get_assistant();
+
+		// create a modifiable copy of the `source_value_str`.
+		//
 		// The value string will have a NUL sentinel at both ends while we process it.
 		// This helps simplify and speed up the suffix checks below.
-		*vs++ = 0;
-		strcpy(vs, svs);
+		const char *svs = source_value_str.c_str();
+		const auto slen = strlen(svs);
+		std::string buf(slen + 2, '\0');
+		memcpy(buf.data() + 1, svs, slen);
+		char *vs = buf.data() + 1;
+		DEBUG_ASSERT(vs[-1] == 0);
 		DEBUG_ASSERT(vs[slen] == 0);
 
 		// start parsing: `vs` points 1 NUL sentinel past the start of the allocated buffer space.
@@ -122,32 +273,12 @@ namespace parameters {
 			}
 			// we DO NOT accept empty (string) element values!
 			if (*s) {
-				// IntParam_ParamOnParseFunction(...) derivative chunk, parsing a single integer:
-				char *endptr = nullptr;
-				// https://stackoverflow.com/questions/25315191/need-to-clean-up-errno-before-calling-function-then-checking-errno?rq=3
-				clear_errno();
-				auto parsed_value = strtol(s, &endptr, 10);
-				auto ec = errno;
-				int32_t val = int32_t(parsed_value);
-				bool good = (endptr != nullptr && ec == E_OK);
-				std::string errmsg;
-				if (good) {
-					// check to make sure the tail is legal: all whitespace has been stripped already, so the tail must be empty!
-					// This also takes care of utter parse failure (when not already signaled via `errno`) when strtol() returns 0 and sets `endptr == s`.
-					good = (*endptr == '\0');
-
-					// check if our parsed value is out of legal range: we check the type conversion as that is faster than checking against [INT32_MIN, INT32_MAX].
-					if (val != parsed_value && ec == E_OK) {
-						good = false;
-						ec = ERANGE;
-					}
-				} else {
-					// failed to parse value.
+				const char *endptr = nullptr;
+				ElemT val{};
+				int ec = E_OK;
+				if (!Traits::parse_element(s, endptr, val, ec)) {
 					if (!endptr)
 						endptr = s;
-				}
-
-				if (!good) {
 					pos = endptr - vs;
 
 					// produce a sensible snippet of this element plus what follows...
@@ -163,20 +294,18 @@ namespace parameters {
 					}
 
 					target.fault();
-					if (ec != E_OK) {
-						if (ec == ERANGE) {
-							errmsg = fmt::format("the parser stopped at item #{} (\"{}\") and reported an integer value overflow (ERANGE); we accept decimal values between {} and {}.", new_value.size(), tailstr, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
-						} else {
-							errmsg = fmt::format("the parser stopped at item #{} (\"{}\") and reported \"{}\" (errno: {})", new_value.size(), tailstr, strerror(ec), ec);
-						}
-					} else if (endptr > vs) {
+					std::string errmsg;
+					if (ec == ERANGE) {
+						errmsg = fmt::format("the parser stopped at item #{} (\"{}\") and reported {}", new_value.size(), tailstr, Traits::range_error_info());
+					} else if (ec != E_OK) {
+						errmsg = fmt::format("the parser stopped at item #{} (\"{}\") and reported \"{}\" (errno: {})", new_value.size(), tailstr, strerror(ec), ec);
+					} else if (endptr > s) {
 						errmsg = fmt::format("the parser stopped early at item #{} (\"{}\"): the tail end (\"{}\") of the element value string remains", new_value.size(), tailstr, endptr);
 					} else {
-						errmsg = fmt::format("the parser was unable to parse anything at all at item #{} (\"{}\")", new_value.size(), tailstr);
+						errmsg = fmt::format("the parser was unable to parse anything at all at item #{} (\"{}\"){}", new_value.size(), tailstr, Traits::accepted_values_info);
 					}
 					PARAM_ERROR("ERROR: error parsing {} parameter '{}' value (\"{}\") to {}; {}. The parameter value will not be adjusted: the preset value ({}) will be used instead.\n", ParamUtils::GetApplicationName(), target.name_str(), source_value_str, target.value_type_str(), errmsg, target.formatted_value_str());
-
-					return; // Note: vs_dropper will take care of our heap-allocated scratch buffer for us.
+					return;
 				}
 
 				new_value.push_back(val);
@@ -187,11 +316,12 @@ namespace parameters {
 		pos = slen;
 	}
 
-	static inline std::string fmt_stringset_vector(const std::vector<int32_t> &value, const char *prefix, const char *suffix, const char *separator) {
+	template <class T>
+	static inline std::string fmt_numberset_vector(const std::vector<T> &value, const char *prefix, const char *suffix, const char *separator) {
 		std::string rv;
 		rv = prefix;
-		for (int32_t elem : value) {
-			rv += elem;
+		for (T elem : value) {
+			rv += fmt::format("{}", elem);
 			rv += separator;
 		}
 		if (value.size()) {
@@ -204,7 +334,8 @@ namespace parameters {
 		return rv;
 	}
 
-	std::string IntSetParam_ParamOnFormatFunction(const IntSetParam &source, const std::vector<int32_t> &value, const std::vector<int32_t> &default_value, ValueFetchPurpose purpose) {
+	template <class ElemT>
+	std::string NumberSetParam_ParamOnFormatFunction(const BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant> &source, const std::vector<ElemT> &value, const std::vector<ElemT> &default_value, ValueFetchPurpose purpose) {
 		const BasicVectorParamParseAssistant &assistant = source.get_assistant();
 		switch (purpose) {
 			// Fetches the (raw, parseble for re-use via set_value()) value of the param as a string.
@@ -214,26 +345,26 @@ namespace parameters {
 			// NOTE: The part where the documentation says this variant MUST update the parameter usage statistics is
 			// handled by the Param class code itself; no need for this callback to handle that part of the deal.
 		case ValueFetchPurpose::VALSTR_PURPOSE_DATA_4_USE:
-			return fmt_stringset_vector(value, assistant.fmt_data_prefix.c_str(), assistant.fmt_data_postfix.c_str(), assistant.fmt_data_separator.c_str());
+			return fmt_numberset_vector(value, assistant.fmt_data_prefix.c_str(), assistant.fmt_data_postfix.c_str(), assistant.fmt_data_separator.c_str());
 
 			// Fetches the (formatted for print/display) value of the param as a string.
 		case ValueFetchPurpose::VALSTR_PURPOSE_DATA_FORMATTED_4_DISPLAY:
-			return fmt_stringset_vector(value, assistant.fmt_display_prefix.c_str(), assistant.fmt_display_postfix.c_str(), assistant.fmt_display_separator.c_str());
+			return fmt_numberset_vector(value, assistant.fmt_display_prefix.c_str(), assistant.fmt_display_postfix.c_str(), assistant.fmt_display_separator.c_str());
 
 			// Fetches the (raw, parseble for re-use via set_value()) default value of the param as a string.
 		case ValueFetchPurpose::VALSTR_PURPOSE_RAW_DEFAULT_DATA_4_INSPECT:
-			return fmt_stringset_vector(default_value, assistant.fmt_data_prefix.c_str(), assistant.fmt_data_postfix.c_str(), assistant.fmt_data_separator.c_str());
+			return fmt_numberset_vector(default_value, assistant.fmt_data_prefix.c_str(), assistant.fmt_data_postfix.c_str(), assistant.fmt_data_separator.c_str());
 
 			// Fetches the (formatted for print/display) default value of the param as a string.
 		case ValueFetchPurpose::VALSTR_PURPOSE_DEFAULT_DATA_FORMATTED_4_DISPLAY:
-			return fmt_stringset_vector(default_value, assistant.fmt_display_prefix.c_str(), assistant.fmt_display_postfix.c_str(), assistant.fmt_display_separator.c_str());
+			return fmt_numberset_vector(default_value, assistant.fmt_display_prefix.c_str(), assistant.fmt_display_postfix.c_str(), assistant.fmt_display_separator.c_str());
 
 			// Return string representing the type of the parameter value, e.g. "integer".
 		case ValueFetchPurpose::VALSTR_PURPOSE_TYPE_INFO_4_INSPECT:
-			return "Int32Array";
+			return NumberSetElementTraits<ElemT>::type_info_4_inspect;
 
 		case ValueFetchPurpose::VALSTR_PURPOSE_TYPE_INFO_4_DISPLAY:
-			return "set of integers";
+			return NumberSetElementTraits<ElemT>::type_info_4_display;
 
 		default:
 			DEBUG_ASSERT(0);
@@ -241,27 +372,33 @@ namespace parameters {
 		}
 	}
 
-	template<>
-	IntSetParam::BasicVectorTypedParam(const std::vector<int32_t> &value, const BasicVectorParamParseAssistant &assistant, THE_4_HANDLERS_PROTO_4_IMPL)
+	// The BasicVectorTypedParam members below are shared by the numeric set types only: StringSetParam comes with its own
+	// specializations (see ParamArrayType_StringBaseType.cpp), hence these are explicitly instantiated for the numeric
+	// element types at the end of this file.
+
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::BasicVectorTypedParam(const VecT &value, const Assistant &assistant, THE_4_HANDLERS_PROTO_4_IMPL)
 		: Param(name, comment, owner, init),
-		on_modify_f_(on_modify_f ? on_modify_f : IntSetParam_ParamOnModifyFunction),
-		on_validate_f_(on_validate_f ? on_validate_f : IntSetParam_ParamOnValidateFunction),
-		on_parse_f_(on_parse_f ? on_parse_f : IntSetParam_ParamOnParseFunction),
-		on_format_f_(on_format_f ? on_format_f : IntSetParam_ParamOnFormatFunction),
+		on_modify_f_(on_modify_f ? on_modify_f : NumberSetParam_ParamOnModifyFunction<ElemT>),
+		on_validate_f_(on_validate_f ? on_validate_f : NumberSetParam_ParamOnValidateFunction<ElemT>),
+		on_parse_f_(on_parse_f ? on_parse_f : NumberSetParam_ParamOnParseFunction<ElemT>),
+		on_format_f_(on_format_f ? on_format_f : NumberSetParam_ParamOnFormatFunction<ElemT>),
+		on_modify_f_is_default_(!on_modify_f),
+		on_validate_f_is_default_(!on_validate_f),
 		value_(value),
 		default_(value),
 		assistant_(assistant) {
-		type_ = STRING_SET_PARAM;
+		type_ = NumberSetElementTraits<ElemT>::param_type;
 	}
 
-	template<>
-	IntSetParam::BasicVectorTypedParam(const char *value, const BasicVectorParamParseAssistant &assistant, THE_4_HANDLERS_PROTO_4_IMPL)
-		: BasicVectorTypedParam(std::vector<int32_t>(), assistant, name, comment, owner, init, on_modify_f, on_validate_f, on_parse_f, on_format_f) {
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::BasicVectorTypedParam(const char *value, const Assistant &assistant, THE_4_HANDLERS_PROTO_4_IMPL)
+		: BasicVectorTypedParam(VecT(), assistant, name, comment, owner, init, on_modify_f, on_validate_f, on_parse_f, on_format_f) {
 		unsigned int pos = 0;
 		std::string vs(value == nullptr ? "" : value);
-		std::vector<int32_t> vv;
+		VecT vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, PARAM_VALUE_IS_DEFAULT); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, PARAM_VALUE_IS_DEFAULT); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
 			// set_value(vv, PARAM_VALUE_IS_DEFAULT, nullptr);
@@ -269,57 +406,64 @@ namespace parameters {
 		}
 	}
 
-	template<>
-	IntSetParam::operator const std::vector<int32_t> &() const {
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::operator const VecT &() const noexcept {
 		return value();
 	}
 
-	template<>
-	IntSetParam::operator const std::vector<int32_t> *() const {
+	template <class ElemT, class Assistant>
+	BasicVectorTypedParam<ElemT, Assistant>::operator const VecT *() const noexcept {
 		return &value();
 	}
 
-	template<>
-	const char *IntSetParam::c_str() const {
+	template <class ElemT, class Assistant>
+	const char *BasicVectorTypedParam<ElemT, Assistant>::c_str() const {
 		return value_str(VALSTR_PURPOSE_DATA_4_USE).c_str();
 	}
 
-	template<>
-	bool IntSetParam::empty() const noexcept {
+	template <class ElemT, class Assistant>
+	bool BasicVectorTypedParam<ElemT, Assistant>::empty() const noexcept {
 		return value().empty();
 	}
 
-	template<>
-	void IntSetParam::operator=(const std::vector<int32_t> &value) {
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::operator=(const VecT &value) {
 		set_value(value, ParamUtils::get_current_application_default_param_source_type(), nullptr);
 	}
 
-	template<>
-	void IntSetParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source) {
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		unsigned int pos = 0;
 		std::string vs(v == nullptr ? "" : v);
-		std::vector<int32_t> vv;
+		// re-applying the input we parsed last time? Then we can skip the parse handler entirely.
+		const VecT *cached = parse_cache_lookup(vs, source_type);
+		if (cached) {
+			set_value(*cached, source_type, source PARAM_CALL_SITE_ARG);
+			return;
+		}
+		VecT vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
-			set_value(vv, source_type, source);
+			parse_cache_store(vs, source_type, vv);
+			set_value(vv, source_type, source PARAM_CALL_SITE_ARG);
 		}
 	}
 
-	template <>
-	void IntSetParam::set_value(const std::vector<int32_t> &val, ParamSetBySourceType source_type, ParamPtr source) {
-		safe_inc(access_counts_.writing);
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::set_value(const VecT &val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
 		// ^^^^^^^ --
 		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
 		// Any real change is tracked by the 'changing' statistic (see further below)!
 
-		std::vector<int32_t> value(val);
+		VecT value(val);
 		reset_fault();
 		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
 		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
 		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
-		on_validate_f_(*this, value_, value, default_, source_type);
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
 		if (!has_faulted()) {
 			// however, when we failed the validation only in the sense of the value being adjusted/restricted by the validator,
 			// then we must set the value as set by the validator anyway, so nothing changes in our workflow here.
@@ -328,9 +472,10 @@ namespace parameters {
 			set_to_non_default_value_ = (value != default_);
 
 			if (value != value_) {
-				on_modify_f_(*this, value_, value, default_, source_type, source);
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
 				if (!has_faulted() && value != value_) {
-					safe_inc(access_counts_.changing);
+					note_value_change();
+					count_access(access_counts_.changing);
 					value_ = value;
 				}
 			}
@@ -338,9 +483,9 @@ namespace parameters {
 		// any signaled fault will be visible outside...
 	}
 
-	template <>
-	const std::vector<int32_t> &IntSetParam::value() const noexcept {
-		safe_inc(access_counts_.reading);
+	template <class ElemT, class Assistant>
+	const typename BasicVectorTypedParam<ElemT, Assistant>::VecT &BasicVectorTypedParam<ElemT, Assistant>::value(PARAM_CALL_SITE_ONLY_PARAM) const noexcept {
+		count_read(PARAM_CALL_SITE_ONLY_ARG);
 		return value_;
 	}
 
@@ -348,10 +493,10 @@ namespace parameters {
 	// When no source vector is specified, or when the source vector does not specify this
 	// particular parameter, then our value is reset to the default value which was
 	// specified earlier in our constructor.
-	template<>
-	void IntSetParam::ResetToDefault(const ParamsVectorSet *source_vec, ParamSetBySourceType source_type) {
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::ResetToDefault(const ParamsVectorSet *source_vec, ParamSetBySourceType source_type) {
 		if (source_vec != nullptr) {
-			IntSetParam *source = source_vec->find<IntSetParam>(name_str());
+			RTP *source = source_vec->find<RTP>(name_str());
 			if (source != nullptr) {
 				set_value(source->value(), PARAM_VALUE_IS_RESET, source);
 				return;
@@ -360,62 +505,98 @@ namespace parameters {
 		set_value(default_, PARAM_VALUE_IS_RESET, nullptr);
 	}
 
-	template <>
-	std::string IntSetParam::value_str(ValueFetchPurpose purpose) const {
+	template <class ElemT, class Assistant>
+	std::string BasicVectorTypedParam<ElemT, Assistant>::value_str(ValueFetchPurpose purpose) const {
 		if (purpose == VALSTR_PURPOSE_DATA_4_USE)
-			safe_inc(access_counts_.reading);
-		return on_format_f_(*this, value_, default_, purpose);
+			count_access(access_counts_.reading);
+		return call_handler(ON_FORMAT_HANDLER, on_format_f_, *this, value_, default_, purpose);
 	}
 
-	template<>
-	IntSetParam::ParamOnModifyFunction IntSetParam::set_on_modify_handler(IntSetParam::ParamOnModifyFunction on_modify_f) {
-		IntSetParam::ParamOnModifyFunction rv = on_modify_f_;
+	template <class ElemT, class Assistant>
+	typename BasicVectorTypedParam<ElemT, Assistant>::ParamOnModifyFunction BasicVectorTypedParam<ElemT, Assistant>::set_on_modify_handler(ParamOnModifyFunction on_modify_f) {
+		ParamOnModifyFunction rv = on_modify_f_;
+		on_modify_f_is_default_ = !on_modify_f;
 		if (!on_modify_f)
-			on_modify_f = IntSetParam_ParamOnModifyFunction;
+			on_modify_f = NumberSetParam_ParamOnModifyFunction<ElemT>;
 		on_modify_f_ = on_modify_f;
 		return rv;
 	}
-	template<>
-	void IntSetParam::clear_on_modify_handler() {
-		on_modify_f_ = IntSetParam_ParamOnModifyFunction;
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::clear_on_modify_handler() {
+		on_modify_f_ = NumberSetParam_ParamOnModifyFunction<ElemT>;
+		on_modify_f_is_default_ = true;
 	}
-	template<>
-	IntSetParam::ParamOnValidateFunction IntSetParam::set_on_validate_handler(IntSetParam::ParamOnValidateFunction on_validate_f) {
-		IntSetParam::ParamOnValidateFunction rv = on_validate_f_;
+	template <class ElemT, class Assistant>
+	typename BasicVectorTypedParam<ElemT, Assistant>::ParamOnValidateFunction BasicVectorTypedParam<ElemT, Assistant>::set_on_validate_handler(ParamOnValidateFunction on_validate_f) {
+		ParamOnValidateFunction rv = on_validate_f_;
+		on_validate_f_is_default_ = !on_validate_f;
 		if (!on_validate_f)
-			on_validate_f = IntSetParam_ParamOnValidateFunction;
+			on_validate_f = NumberSetParam_ParamOnValidateFunction<ElemT>;
 		on_validate_f_ = on_validate_f;
 		return rv;
 	}
-	template<>
-	void IntSetParam::clear_on_validate_handler() {
-		on_validate_f_ = IntSetParam_ParamOnValidateFunction;
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::clear_on_validate_handler() {
+		on_validate_f_ = NumberSetParam_ParamOnValidateFunction<ElemT>;
+		on_validate_f_is_default_ = true;
 	}
-	template<>
-	IntSetParam::ParamOnParseFunction IntSetParam::set_on_parse_handler(IntSetParam::ParamOnParseFunction on_parse_f) {
-		IntSetParam::ParamOnParseFunction rv = on_parse_f_;
+	template <class ElemT, class Assistant>
+	typename BasicVectorTypedParam<ElemT, Assistant>::ParamOnParseFunction BasicVectorTypedParam<ElemT, Assistant>::set_on_parse_handler(ParamOnParseFunction on_parse_f) {
+		ParamOnParseFunction rv = on_parse_f_;
+		invalidate_parse_cache();
 		if (!on_parse_f)
-			on_parse_f = IntSetParam_ParamOnParseFunction;
+			on_parse_f = NumberSetParam_ParamOnParseFunction<ElemT>;
 		on_parse_f_ = on_parse_f;
 		return rv;
 	}
-	template<>
-	void IntSetParam::clear_on_parse_handler() {
-		on_parse_f_ = IntSetParam_ParamOnParseFunction;
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::clear_on_parse_handler() {
+		on_parse_f_ = NumberSetParam_ParamOnParseFunction<ElemT>;
+		invalidate_parse_cache();
 	}
-	template<>
-	IntSetParam::ParamOnFormatFunction IntSetParam::set_on_format_handler(IntSetParam::ParamOnFormatFunction on_format_f) {
-		IntSetParam::ParamOnFormatFunction rv = on_format_f_;
+	template <class ElemT, class Assistant>
+	typename BasicVectorTypedParam<ElemT, Assistant>::ParamOnFormatFunction BasicVectorTypedParam<ElemT, Assistant>::set_on_format_handler(ParamOnFormatFunction on_format_f) {
+		ParamOnFormatFunction rv = on_format_f_;
 		if (!on_format_f)
-			on_format_f = IntSetParam_ParamOnFormatFunction;
+			on_format_f = NumberSetParam_ParamOnFormatFunction<ElemT>;
 		on_format_f_ = on_format_f;
 		return rv;
 	}
-	template<>
-	void IntSetParam::clear_on_format_handler() {
-		on_format_f_ = IntSetParam_ParamOnFormatFunction;
+	template <class ElemT, class Assistant>
+	void BasicVectorTypedParam<ElemT, Assistant>::clear_on_format_handler() {
+		on_format_f_ = NumberSetParam_ParamOnFormatFunction<ElemT>;
 	}
 
+	// The numeric set parameter types which are actually available in this library:
+
+#define INSTANTIATE_NUMBER_SET_PARAM(ElemT)																								\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::BasicVectorTypedParam(const std::vector<ElemT> &, const BasicVectorParamParseAssistant &, THE_4_HANDLERS_PROTO_4_IMPL); \
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::BasicVectorTypedParam(const char *, const BasicVectorParamParseAssistant &, THE_4_HANDLERS_PROTO_4_IMPL); \
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::operator const std::vector<ElemT> &() const noexcept;			\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::operator const std::vector<ElemT> *() const noexcept;			\
+	template const char *BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::c_str() const;									\
+	template bool BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::empty() const noexcept;									\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::operator=(const std::vector<ElemT> &);					\
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_value(const char *, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_value(const std::vector<ElemT> &, ParamSetBySourceType, ParamPtr PARAM_CALL_SITE_PARAM_TYPE); \
+	template const std::vector<ElemT> &BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::value(PARAM_CALL_SITE_ONLY_PARAM_TYPE) const noexcept; \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ResetToDefault(const ParamsVectorSet *, ParamSetBySourceType); \
+	template std::string BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::value_str(ValueFetchPurpose) const;				\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ParamOnModifyFunction BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_on_modify_handler(ParamOnModifyFunction); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::clear_on_modify_handler();								\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ParamOnValidateFunction BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_on_validate_handler(ParamOnValidateFunction); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::clear_on_validate_handler();							\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ParamOnParseFunction BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_on_parse_handler(ParamOnParseFunction); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::clear_on_parse_handler();								\
+	template BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::ParamOnFormatFunction BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::set_on_format_handler(ParamOnFormatFunction); \
+	template void BasicVectorTypedParam<ElemT, BasicVectorParamParseAssistant>::clear_on_format_handler()
+
+	INSTANTIATE_NUMBER_SET_PARAM(int32_t);
+	INSTANTIATE_NUMBER_SET_PARAM(double);
+	INSTANTIATE_NUMBER_SET_PARAM(bool);
+
+#undef INSTANTIATE_NUMBER_SET_PARAM
+
 #if 0
 	std::string IntSetParam::formatted_value_str() const {
 		std::string rv = "\u00AB";
@@ -189,6 +189,8 @@ namespace parameters {
 		on_validate_f_(on_validate_f ? on_validate_f : StringSetParam_ParamOnValidateFunction),
 		on_parse_f_(on_parse_f ? on_parse_f : StringSetParam_ParamOnParseFunction),
 		on_format_f_(on_format_f ? on_format_f : StringSetParam_ParamOnFormatFunction),
+		on_modify_f_is_default_(!on_modify_f),
+		on_validate_f_is_default_(!on_validate_f),
 		value_(value),
 		default_(value),
 		assistant_(assistant) {
@@ -203,7 +205,7 @@ namespace parameters {
 		std::string vs(value == nullptr ? "" : value);
 		std::vector<std::string> vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, PARAM_VALUE_IS_DEFAULT); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, PARAM_VALUE_IS_DEFAULT); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
 			//set_value(vv, PARAM_VALUE_IS_DEFAULT, nullptr);
@@ -237,21 +239,28 @@ namespace parameters {
 	}
 
 	template<>
-	void StringSetParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source) {
+	void StringSetParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		unsigned int pos = 0;
 		std::string vs(v == nullptr ? "" : v);
+		// re-applying the input we parsed last time? Then we can skip the parse handler entirely.
+		const std::vector<std::string> *cached = parse_cache_lookup(vs, source_type);
+		if (cached) {
+			set_value(*cached, source_type, source PARAM_CALL_SITE_ARG);
+			return;
+		}
 		std::vector<std::string> vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
-			set_value(vv, source_type, source);
+			parse_cache_store(vs, source_type, vv);
+			set_value(vv, source_type, source PARAM_CALL_SITE_ARG);
 		}
 	}
 
 	template <>
-	void StringSetParam::set_value(const std::vector<std::string> &val, ParamSetBySourceType source_type, ParamPtr source) {
-		safe_inc(access_counts_.writing);
+	void StringSetParam::set_value(const std::vector<std::string> &val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
 		// ^^^^^^^ --
 		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
 		// Any real change is tracked by the 'changing' statistic (see further below)!
@@ -261,7 +270,7 @@ namespace parameters {
 		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
 		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
 		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
-		on_validate_f_(*this, value_, value, default_, source_type);
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
 		if (!has_faulted()) {
 			// however, when we failed the validation only in the sense of the value being adjusted/restricted by the validator,
 			// then we must set the value as set by the validator anyway, so nothing changes in our workflow here.
@@ -270,9 +279,10 @@ namespace parameters {
 			set_to_non_default_value_ = (value != default_);
 
 			if (value != value_) {
-				on_modify_f_(*this, value_, value, default_, source_type, source);
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
 				if (!has_faulted() && value != value_) {
-					safe_inc(access_counts_.changing);
+					note_value_change();
+					count_access(access_counts_.changing);
 					value_ = value;
 				}
 			}
@@ -281,8 +291,8 @@ namespace parameters {
 	}
 
 	template <>
-	const std::vector<std::string> &StringSetParam::value() const noexcept {
-		safe_inc(access_counts_.reading);
+	const std::vector<std::string> &StringSetParam::value(PARAM_CALL_SITE_ONLY_PARAM) const noexcept {
+		count_read(PARAM_CALL_SITE_ONLY_ARG);
 		return value_;
 	}
 
@@ -305,13 +315,14 @@ namespace parameters {
 	template<>
 	std::string StringSetParam::value_str(ValueFetchPurpose purpose) const {
 		if (purpose == VALSTR_PURPOSE_DATA_4_USE)
-			safe_inc(access_counts_.reading);
-		return on_format_f_(*this, value_, default_, purpose);
+			count_access(access_counts_.reading);
+		return call_handler(ON_FORMAT_HANDLER, on_format_f_, *this, value_, default_, purpose);
 	}
 
 	template<>
 	StringSetParam::ParamOnModifyFunction StringSetParam::set_on_modify_handler(StringSetParam::ParamOnModifyFunction on_modify_f) {
 		StringSetParam::ParamOnModifyFunction rv = on_modify_f_;
+		on_modify_f_is_default_ = !on_modify_f;
 		if (!on_modify_f)
 			on_modify_f = StringSetParam_ParamOnModifyFunction;
 		on_modify_f_ = on_modify_f;
@@ -320,10 +331,12 @@ namespace parameters {
 	template<>
 	void StringSetParam::clear_on_modify_handler() {
 		on_modify_f_ = StringSetParam_ParamOnModifyFunction;
+		on_modify_f_is_default_ = true;
 	}
 	template<>
 	StringSetParam::ParamOnValidateFunction StringSetParam::set_on_validate_handler(StringSetParam::ParamOnValidateFunction on_validate_f) {
 		StringSetParam::ParamOnValidateFunction rv = on_validate_f_;
+		on_validate_f_is_default_ = !on_validate_f;
 		if (!on_validate_f)
 			on_validate_f = StringSetParam_ParamOnValidateFunction;
 		on_validate_f_ = on_validate_f;
@@ -332,10 +345,12 @@ namespace parameters {
 	template<>
 	void StringSetParam::clear_on_validate_handler() {
 		on_validate_f_ = StringSetParam_ParamOnValidateFunction;
+		on_validate_f_is_default_ = true;
 	}
 	template<>
 	StringSetParam::ParamOnParseFunction StringSetParam::set_on_parse_handler(StringSetParam::ParamOnParseFunction on_parse_f) {
 		StringSetParam::ParamOnParseFunction rv = on_parse_f_;
+		invalidate_parse_cache();
 		if (!on_parse_f)
 			on_parse_f = StringSetParam_ParamOnParseFunction;
 		on_parse_f_ = on_parse_f;
@@ -344,6 +359,7 @@ namespace parameters {
 	template<>
 	void StringSetParam::clear_on_parse_handler() {
 		on_parse_f_ = StringSetParam_ParamOnParseFunction;
+		invalidate_parse_cache();
 	}
 	template<>
 	StringSetParam::ParamOnFormatFunction StringSetParam::set_on_format_handler(StringSetParam::ParamOnFormatFunction on_format_f) {
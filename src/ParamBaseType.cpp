@@ -5,6 +5,9 @@
 #include "logchannel_helpers.hpp"
 #include "os_platform_helpers.hpp"
 
+#include <chrono>
+#include <ctime>
+
 
 namespace parameters {
 
@@ -32,11 +35,17 @@ namespace parameters {
 		set_to_non_default_value_(false),
 		locked_(false),
 		error_(false),
+		touched_(false),
+		next_touched_(nullptr),
 
 		type_(UNKNOWN_PARAM),
 		set_mode_(PARAM_VALUE_IS_DEFAULT),
 		setter_(nullptr),
-		access_counts_({0, 0, 0, 0})
+		access_counts_({0, 0, 0, 0, 0, 0, 0, 0}),
+		access_times_(nullptr),
+		handler_timings_(nullptr),
+		// a newly registered parameter counts as 'changed' as far as any existing snapshots are concerned:
+		version_(last_issued_version_.fetch_add(1, std::memory_order_relaxed) + 1)
 	{
 		debug_ = (strstr(name, "debug") != nullptr) || (strstr(name, "display") != nullptr);
 
@@ -47,6 +56,8 @@ namespace parameters {
 	}
 
 	Param::~Param() {
+		delete access_times_;
+		delete handler_timings_;
 		if (info_)
 			free((void *)info_);
 		if (name_)
@@ -82,7 +93,7 @@ namespace parameters {
 		locked_ = locking;
 	}
 	void Param::fault() noexcept {
-		safe_inc(access_counts_.faulting);
+		count_access(access_counts_.faulting);
 		error_ = true;
 	}
 
@@ -101,11 +112,163 @@ namespace parameters {
 		return owner_;
 	}
 
+	std::atomic<uint64_t> Param::last_issued_version_{0};
+
+	uint64_t Param::version() const noexcept {
+		return version_;
+	}
+
+	uint64_t Param::current_version() noexcept {
+		return last_issued_version_.load(std::memory_order_relaxed);
+	}
+
+	SnapshotSeries *Param::active_journal_ = nullptr;
+
+	void Param::note_value_change() noexcept {
+		// The first change since the last snapshot point gets journaled, so that a rewind can undo it.
+		// Any subsequent change will have a newer version than the journal mark, so those are skipped at the cost of a single comparison.
+		if (active_journal_ != nullptr && version_ <= active_journal_->journal_mark) {
+			active_journal_->JournalParamChange(this);
+		}
+		version_ = last_issued_version_.fetch_add(1, std::memory_order_relaxed) + 1;
+		if (access_times_ != nullptr)
+			access_times_->last_change = ParamUtils::AccessClockNow();
+	}
+
 	const Param::access_counts_t &Param::access_counts() const noexcept {
 		return access_counts_;
 	}
 
+	void Param::note_first_access() const noexcept {
+		// this is on the read path, possibly executed by multiple threads at once: no locks, no heap allocations.
+		if (touched_.exchange(true, std::memory_order_acq_rel))
+			return;
+		owner_.push_touched(const_cast<Param *>(this));
+	}
+
+	void Param::note_access_time(const uint32_t &counter) const {
+		// only reads are timestamped here: value changes are handled by note_value_change().
+		if (&counter != &access_counts_.reading)
+			return;
+		uint64_t now = ParamUtils::AccessClockNow();
+		if (access_times_->first_read == 0)
+			access_times_->first_read = now;
+		access_times_->last_read = now;
+	}
+
+	void Param::track_access_times(bool enable) {
+		if (!enable) {
+			delete access_times_;
+			access_times_ = nullptr;
+		} else if (access_times_ == nullptr) {
+			access_times_ = new access_times_t{0, 0, 0};
+		}
+	}
+
+	const Param::access_times_t *Param::access_times() const noexcept {
+		return access_times_;
+	}
+
+	void Param::track_handler_timings(bool enable) {
+		if (!enable) {
+			delete handler_timings_;
+			handler_timings_ = nullptr;
+		} else if (handler_timings_ == nullptr) {
+			handler_timings_ = new handler_timings_t{};
+		}
+	}
+
+	const Param::handler_timings_t *Param::handler_timings() const noexcept {
+		return handler_timings_;
+	}
+
+	const char *Param::handler_kind_str(HandlerKind kind) noexcept {
+		switch (kind) {
+		case ON_PARSE_HANDLER:
+			return "parse";
+		case ON_VALIDATE_HANDLER:
+			return "validate";
+		case ON_MODIFY_HANDLER:
+			return "modify";
+		case ON_FORMAT_HANDLER:
+			return "format";
+		default:
+			return "?";
+		}
+	}
+
+#if PARAMETERS_TRACK_CALL_SITES
+	uint32_t Param::call_site_read_sample_mask_ = 64 - 1;
+
+	void Param::note_call_site(const std::source_location &call_site, bool write) const {
+		// the library's own bookkeeping reads don't carry a call site.
+		if (call_site.line() == 0)
+			return;
+		// a parameter is accessed from a handful of locations at most, so a linear scan suffices.
+		// file_name() and function_name() produce string literals, so we can compare by pointer.
+		for (call_site_t &site : call_sites_) {
+			if (site.line == call_site.line() && site.file == call_site.file_name() && site.function == call_site.function_name()) {
+				if (write)
+					site.writes++;
+				else
+					site.sampled_reads++;
+				return;
+			}
+		}
+		call_sites_.push_back({call_site.file_name(), call_site.function_name(), uint32_t(call_site.line()), uint64_t(write), uint64_t(!write)});
+	}
+
+	const std::vector<Param::call_site_t> &Param::call_sites() const noexcept {
+		return call_sites_;
+	}
+
+	void Param::clear_call_sites() noexcept {
+		call_sites_.clear();
+	}
+
+	void Param::set_call_site_read_sampling(uint32_t interval) noexcept {
+		uint32_t mask = 0;
+		while (mask < 0x80000000U && mask + 1 < interval)
+			mask = (mask << 1) | 1;
+		call_site_read_sample_mask_ = mask;
+	}
+
+	uint32_t Param::call_site_read_sampling() noexcept {
+		return call_site_read_sample_mask_ + 1;
+	}
+#endif
+
+#if defined(CLOCK_MONOTONIC_COARSE)
+	static uint64_t raw_access_clock() noexcept {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+		return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+	}
+#elif defined(_WIN32)
+	static uint64_t raw_access_clock() noexcept {
+		return uint64_t(::GetTickCount64()) * 1000000ULL;
+	}
+#else
+	static uint64_t raw_access_clock() noexcept {
+		return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+#endif
+
+	static const uint64_t access_clock_origin = raw_access_clock();
+
+	uint64_t ParamUtils::AccessClockNow() noexcept {
+		// never produce 0, as that signals 'never happened' in the access timestamps.
+		uint64_t t = raw_access_clock() - access_clock_origin;
+		return t + (t == 0);
+	}
+
 	void Param::reset_access_counts() noexcept {
+		// fold the section counts into the run totals:
+		safe_add(access_counts_.prev_sum_reading, access_counts_.reading);
+		safe_add(access_counts_.prev_sum_writing, access_counts_.writing);
+		safe_add(access_counts_.prev_sum_changing, access_counts_.changing);
+		safe_add(access_counts_.prev_sum_faulting, access_counts_.faulting);
+
 		access_counts_.reading = 0;
 		access_counts_.writing = 0;
 		access_counts_.changing = 0;
@@ -136,8 +299,8 @@ namespace parameters {
 		return value_str(VALSTR_PURPOSE_TYPE_INFO_4_DISPLAY);
 	}
 
-	void Param::set_value(const std::string &v, ParamSetBySourceType source_type, ParamPtr source) {
-		set_value(v.c_str(), source_type, source);
+	void Param::set_value(const std::string &v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		set_value(v.c_str(), source_type, source PARAM_CALL_SITE_ARG);
 	}
 
 	void Param::operator=(const char *value) {
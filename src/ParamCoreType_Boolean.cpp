@@ -26,99 +26,173 @@ namespace parameters {
 		return;
 	}
 
-	void BoolParam_ParamOnParseFunction(BoolParam &target, bool &new_value, const std::string &source_value_str, unsigned int &pos, ParamSetBySourceType source_type) {
-		const char *vs = source_value_str.c_str();
-		char *endptr = nullptr;
-		// https://stackoverflow.com/questions/25315191/need-to-clean-up-errno-before-calling-function-then-checking-errno?rq=3
-		clear_errno();
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// boolean value classifier, shared by BoolParam and BoolSetParam
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Character classes, used by the table-driven boolean value parser below.
+	enum : uint8_t {
+		BCC_SPACE = 0x01,
+		BCC_ALPHA = 0x02,
+		BCC_DIGIT = 0x04,    // decimal digit
+		BCC_SIGN = 0x08,     // numeric sign: + or -
+		BCC_TRUE = 0x10,     // first character of a TRUE word or symbol
+		BCC_FALSE = 0x20,    // first character of a FALSE word or symbol
+		BCC_SYMBOL = 0x40,   // TRUE/FALSE symbol, which is only valid when alone
+	};
+
+	struct boolean_parser_tables {
+		uint8_t cclass[256];
+		uint8_t digit_value[256];   // 0..35 for [0-9a-zA-Z]; 0xFF for everything else.
+
+		constexpr boolean_parser_tables() : cclass(), digit_value() {
+			for (int c = 0; c < 256; c++) {
+				uint8_t cc = 0;
+				uint8_t dv = 0xFF;
+				if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v')
+					cc |= BCC_SPACE;
+				if (c >= '0' && c <= '9') {
+					cc |= BCC_DIGIT;
+					dv = uint8_t(c - '0');
+				}
+				if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+					cc |= BCC_ALPHA;
+					dv = uint8_t((c | 0x20) - 'a' + 10);
+				}
+				switch (c | 0x20) {
+				// [T]rue, [Y]es, [J]a: only valid when a single char or word.
+				// (and, yes, we are very lenient: if some Smart Alec enters "Tamagotchi" as a value here, we consider that a valid equivalent to TRUE. Tolerant *by design*.)
+				case 't':
+				case 'y':
+				case 'j':
+					if (cc & BCC_ALPHA)
+						cc |= BCC_TRUE;
+					break;
+
+				// [F]alse, [N]o: only valid when a single char or word.
+				case 'f':
+				case 'n':
+					if (cc & BCC_ALPHA)
+						cc |= BCC_FALSE;
+					break;
+
+				// 'x' marks the spot: on; only valid when alone.
+				case 'x':
+					if (cc & BCC_ALPHA)
+						cc |= BCC_TRUE | BCC_SYMBOL;
+					break;
+				}
+				switch (c) {
+				case '+':
+					cc |= BCC_SIGN | BCC_TRUE | BCC_SYMBOL;
+					break;
+				case '-':
+					cc |= BCC_SIGN | BCC_FALSE | BCC_SYMBOL;
+					break;
+				case '.':
+					cc |= BCC_FALSE | BCC_SYMBOL;
+					break;
+				}
+				cclass[c] = cc;
+				digit_value[c] = dv;
+			}
+		}
+	};
+
+	static constexpr boolean_parser_tables bool_tables;
+
+	int parse_boolean_value(const char *str, const char *&endptr, bool &value) {
+		const uint8_t *s = reinterpret_cast<const uint8_t *>(str);
+		while (bool_tables.cclass[*s] & BCC_SPACE)
+			s++;
+		uint8_t cc = bool_tables.cclass[*s];
+		bool numeric = (cc & BCC_DIGIT) || ((cc & BCC_SIGN) && (bool_tables.cclass[s[1]] & BCC_DIGIT));
+
 		// We accept decimal, hex and octal numbers here, not just the ubiquitous 0, 1 and -1. `+5` also implies TRUE as far as we are concerned. We are tolerant on our input here, not pedantic, *by design*.
 		// However, we do restrict our values to the 32-bit signed range: this is picked for the tolerated numeric value range as that equals the IntPAram (int32_t) one, but granted: this range restriction is
 		// a matter of taste and arguably arbitrary. We've pondered limiting the accepted numerical values to the range of an int8_t (-128 .. + 127) but the ulterior goal here is to stay as close to the int32_t
 		// IntParam value parser code as possible, so int32_t range it is....
-		auto parsed_value = strtol(vs, &endptr, 0);
-		auto ec = errno;
-		int32_t val = int32_t(parsed_value);
-		bool good = (endptr != nullptr && ec == E_OK);
-		std::string errmsg;
-		if (good) {
-			// check to make sure the tail is legal: whitespace only.
-			// This also takes care of utter parse failure (when not already signaled via `errno`) when strtol() returns 0 and sets `endptr == vs`.
-			while (isspace(*endptr))
-				endptr++;
-			good = (*endptr == '\0');
-
-			// check if our parsed value is out of legal range: we check the type conversion as that is faster than checking against [INT32_MIN, INT32_MAX].
-			if (val != parsed_value && ec == E_OK) {
-				good = false;
-				ec = ERANGE;
+		//
+		// The accepted number format equals that of `strtol(s, &endptr, 0)`, but we parse it here in the same pass, rather than trying strtol() first and falling back to the boolean words & symbols afterwards.
+		if (numeric) {
+			bool negative = false;
+			if (cc & BCC_SIGN) {
+				negative = (*s == '-');
+				s++;
 			}
-		} else {
-			// failed to parse boolean value as numeric value (zero, non-zero). Try to parse as a word (true/false) or symbol (+/-) instead.
-			const char *s = vs;
-			while (isspace(*s))
+			unsigned int base = 10;
+			if (s[0] == '0') {
+				if ((s[1] | 0x20) == 'x' && bool_tables.digit_value[s[2]] < 16) {
+					base = 16;
+					s += 2;
+				} else {
+					base = 8;
+				}
+			}
+			// the magnitude limit: INT32_MAX for positive values, -INT32_MIN for negative ones.
+			const uint64_t limit = uint64_t(std::numeric_limits<int32_t>::max()) + (negative ? 1 : 0);
+			uint64_t magnitude = 0;
+			bool overflow = false;
+			for (;;) {
+				unsigned int dv = bool_tables.digit_value[*s];
+				if (dv >= base)
+					break;
+				magnitude = magnitude * base + dv;
+				if (magnitude > limit) {
+					overflow = true;
+					// keep the magnitude from wrapping around while we skip the remaining digits.
+					magnitude = limit + 1;
+				}
 				s++;
-			endptr = (char *)vs;
-			switch (tolower(s[0])) {
-			case 't':
-				// true; only valid when a single char or word:
-				// (and, yes, we are very lenient: if some Smart Alec enters "Tamagotchi" as a value here, we consider that a valid equivalent to TRUE. Tolerant *by design*.)
-				good = is_single_word(s);
-				val = 1;
-				break;
-
-			case 'f':
-				// false; only valid when a single char or word:
-				// (and, yes, we are very lenient again: if some Smart Alec enters "Favela" as a value here, we consider that a valid equivalent to FALSE. Tolerant *by design*. Bite me.)
-				good = is_single_word(s);
-				val = 0;
-				break;
-
-			case 'y':
-			case 'j':
-				// yes / ja; only valid when a single char or word:
-				good = is_single_word(s);
-				val = 1;
-				break;
-
-			case 'n':
-				// no; only valid when a single char or word:
-				good = is_single_word(s);
-				val = 0;
-				break;
-
-			case 'x':
-			case '+':
-				// on; only valid when alone:
-				good = is_optional_whitespace(s + 1);
-				val = 1;
-				break;
-
-			case '-':
-			case '.':
-				// off; only valid when alone:
-				good = is_optional_whitespace(s + 1);
-				val = 0;
-				break;
-
-			default:
-				// we reject everything else as not-a-boolean-value.
-				good = false;
-				break;
 			}
-
-			if (good) {
-				endptr += strlen(endptr);
+			if (overflow) {
+				endptr = reinterpret_cast<const char *>(s);
+				return ERANGE;
 			}
+			value = (magnitude != 0);
+		} else if (cc & BCC_SYMBOL) {
+			// on/off symbol; only valid when alone:
+			value = (cc & BCC_TRUE);
+			s++;
+		} else if (cc & (BCC_TRUE | BCC_FALSE)) {
+			// boolean word; only valid when a single char or word:
+			// (and, yes, we are very lenient again: if some Smart Alec enters "Favela" as a value here, we consider that a valid equivalent to FALSE. Tolerant *by design*. Bite me.)
+			value = (cc & BCC_TRUE);
+			s++;
+			while (bool_tables.cclass[*s] & BCC_ALPHA)
+				s++;
+		} else {
+			// we reject everything else as not-a-boolean-value.
+			endptr = str;
+			return EINVAL;
 		}
 
-		if (!good) {
+		// check to make sure the tail is legal: whitespace only.
+		while (bool_tables.cclass[*s] & BCC_SPACE)
+			s++;
+		if (*s) {
+			// a word or symbol with trailing garbage is not a boolean value at all, while numbers (like strtol()) may be followed by a tail that we report.
+			endptr = (numeric ? reinterpret_cast<const char *>(s) : str);
+			return EINVAL;
+		}
+		endptr = reinterpret_cast<const char *>(s);
+		return E_OK;
+	}
+
+	void BoolParam_ParamOnParseFunction(BoolParam &target, bool &new_value, const std::string &source_value_str, unsigned int &pos, ParamSetBySourceType source_type) {
+		const char *vs = source_value_str.c_str();
+		const char *endptr = nullptr;
+		bool val = false;
+		auto ec = parse_boolean_value(vs, endptr, val);
+		std::string errmsg;
+		if (ec == E_OK) {
+			new_value = val;
+		} else {
 			target.fault();
-			if (ec != E_OK) {
-				if (ec == ERANGE) {
-					errmsg = fmt::format("the parser stopped and reported an integer value overflow (ERANGE); while we expect a boolean value (ideally 1/0/-1), we accept decimal values between {} and {} where any non-zero value equals TRUE.", std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
-				} else {
-					errmsg = fmt::format("the parser stopped and reported \"{}\" (errno: {}) and we were unable to otherwise parse the given value as a boolean word ([T]rue/[F]alse/[Y]es/[J]a/[N]o) or boolean symbol (+/-/.) ", strerror(ec), ec);
-				}
+			if (ec == ERANGE) {
+				errmsg = fmt::format("the parser stopped and reported an integer value overflow (ERANGE); while we expect a boolean value (ideally 1/0/-1), we accept decimal values between {} and {} where any non-zero value equals TRUE.", std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
 			} else if (endptr > vs) {
 				errmsg = fmt::format("the parser stopped early: the tail end (\"{}\") of the value string remains", endptr);
 			} else {
@@ -187,6 +261,7 @@ namespace parameters {
 		on_validate_f_(on_validate_f ? on_validate_f : BoolParam_ParamOnValidateFunction),
 		on_parse_f_(on_parse_f ? on_parse_f : BoolParam_ParamOnParseFunction),
 		on_format_f_(on_format_f ? on_format_f : BoolParam_ParamOnFormatFunction),
+		on_format_f_is_default_(!on_format_f),
 		value_(value),
 		default_(value) {
 		type_ = BOOL_PARAM;
@@ -203,21 +278,21 @@ namespace parameters {
 	}
 
 	template<>
-	void BoolParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source) {
+	void BoolParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		unsigned int pos = 0;
 		std::string vs(v);
 		bool vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
-			set_value(vv, source_type, source);
+			set_value(vv, source_type, source PARAM_CALL_SITE_ARG);
 		}
 	}
 
 	template <>
-	void BoolParam::set_value(bool value, ParamSetBySourceType source_type, ParamPtr source) {
-		safe_inc(access_counts_.writing);
+	void BoolParam::set_value(bool value, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
 		// ^^^^^^^ --
 		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
 		// Any real change is tracked by the 'changing' statistic (see further below)!
@@ -226,7 +301,7 @@ namespace parameters {
 		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
 		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
 		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
-		on_validate_f_(*this, value_, value, default_, source_type);
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
 		if (!has_faulted()) {
 			// however, when we failed the validation only in the sense of the value being adjusted/restricted by the validator,
 			// then we must set the value as set by the validator anyway, so nothing changes in our workflow here.
@@ -235,9 +310,10 @@ namespace parameters {
 			set_to_non_default_value_ = (value != default_);
 
 			if (value != value_) {
-				on_modify_f_(*this, value_, value, default_, source_type, source);
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
 				if (!has_faulted() && value != value_) {
-					safe_inc(access_counts_.changing);
+					note_value_change();
+					count_access(access_counts_.changing);
 					value_ = value;
 				}
 			}
@@ -246,8 +322,8 @@ namespace parameters {
 	}
 
 	template <>
-	bool BoolParam::value() const noexcept {
-		safe_inc(access_counts_.reading);
+	bool BoolParam::value(PARAM_CALL_SITE_ONLY_PARAM) const noexcept {
+		count_read(PARAM_CALL_SITE_ONLY_ARG);
 		return value_;
 	}
 
@@ -270,8 +346,8 @@ namespace parameters {
 	template<>
 	std::string BoolParam::value_str(ValueFetchPurpose purpose) const {
 		if (purpose == VALSTR_PURPOSE_DATA_4_USE)
-			safe_inc(access_counts_.reading);
-		return on_format_f_(*this, value_, default_, purpose);
+			count_access(access_counts_.reading);
+		return call_handler(ON_FORMAT_HANDLER, on_format_f_, *this, value_, default_, purpose);
 	}
 
 	template<>
@@ -313,6 +389,7 @@ namespace parameters {
 	template<>
 	BoolParam::ParamOnFormatFunction BoolParam::set_on_format_handler(BoolParam::ParamOnFormatFunction on_format_f) {
 		BoolParam::ParamOnFormatFunction rv = on_format_f_;
+		on_format_f_is_default_ = !on_format_f;
 		if (!on_format_f)
 			on_format_f = BoolParam_ParamOnFormatFunction;
 		on_format_f_ = on_format_f;
@@ -321,6 +398,7 @@ namespace parameters {
 	template<>
 	void BoolParam::clear_on_format_handler() {
 		on_format_f_ = BoolParam_ParamOnFormatFunction;
+		on_format_f_is_default_ = true;
 	}
 
 #if 0
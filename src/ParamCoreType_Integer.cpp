@@ -131,6 +131,7 @@ namespace parameters {
 		on_validate_f_(on_validate_f ? on_validate_f : IntParam_ParamOnValidateFunction),
 		on_parse_f_(on_parse_f ? on_parse_f : IntParam_ParamOnParseFunction),
 		on_format_f_(on_format_f ? on_format_f : IntParam_ParamOnFormatFunction),
+		on_format_f_is_default_(!on_format_f),
 		value_(value),
 		default_(value)
 	{
@@ -148,20 +149,20 @@ namespace parameters {
 	}
 
 	template<>
-	void IntParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source) {
+	void IntParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		unsigned int pos = 0;
 		std::string vs(v);
 		int32_t vv;
 		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
 		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
 		if (!has_faulted()) {
-			set_value(vv, source_type, source);
+			set_value(vv, source_type, source PARAM_CALL_SITE_ARG);
 		}
 	}
 
 	template<>
-	void IntParam::set_value(int32_t value, ParamSetBySourceType source_type, ParamPtr source) {
+	void IntParam::set_value(int32_t value, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 		reset_fault();
 
 		if (!can_update(source_type)) {
@@ -170,7 +171,7 @@ namespace parameters {
 			return;
 		}
 
-		safe_inc(access_counts_.writing);
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
 		// ^^^^^^^ --
 		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
 		// Any real change is tracked by the 'changing' statistic (see further below)!
@@ -178,15 +179,16 @@ namespace parameters {
 		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
 		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
 		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
-		on_validate_f_(*this, value_, value, default_, source_type);
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
 		if (!has_faulted()) {
 			// however, when we failed the validation only in the sense of the value being adjusted/restricted by the validator,
 			// then we must set the value as set by the validator anyway, so nothing changes in our workflow here.
 			if (value != value_) {
-				on_modify_f_(*this, value_, value, default_, source_type, source);
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
 				if (!has_faulted()) {
 					if (value != value_) {
-						safe_inc(access_counts_.changing);
+						note_value_change();
+						count_access(access_counts_.changing);
 						value_ = value;
 
 						set_to_non_default_value_ = (value != default_);
@@ -202,8 +204,8 @@ namespace parameters {
 	}
 
 	template <>
-	int32_t IntParam::value() const noexcept {
-		safe_inc(access_counts_.reading);
+	int32_t IntParam::value(PARAM_CALL_SITE_ONLY_PARAM) const noexcept {
+		count_read(PARAM_CALL_SITE_ONLY_ARG);
 		return value_;
 	}
 
@@ -226,8 +228,8 @@ namespace parameters {
 	template<>
 	std::string IntParam::value_str(ValueFetchPurpose purpose) const {
 		if (purpose == VALSTR_PURPOSE_DATA_4_USE)
-			safe_inc(access_counts_.reading);
-		return on_format_f_(*this, value_, default_, purpose);
+			count_access(access_counts_.reading);
+		return call_handler(ON_FORMAT_HANDLER, on_format_f_, *this, value_, default_, purpose);
 	}
 
 	template<>
@@ -269,6 +271,7 @@ namespace parameters {
 	template<>
 	IntParam::ParamOnFormatFunction IntParam::set_on_format_handler(IntParam::ParamOnFormatFunction on_format_f) {
 		IntParam::ParamOnFormatFunction rv = on_format_f_;
+		on_format_f_is_default_ = !on_format_f;
 		if (!on_format_f)
 			on_format_f = IntParam_ParamOnFormatFunction;
 		on_format_f_ = on_format_f;
@@ -277,6 +280,7 @@ namespace parameters {
 	template<>
 	void IntParam::clear_on_format_handler() {
 		on_format_f_ = IntParam_ParamOnFormatFunction;
+		on_format_f_is_default_ = true;
 	}
 
 #if 0
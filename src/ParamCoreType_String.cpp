@@ -155,42 +155,19 @@ namespace parameters {
 
 #endif
 
-	template<>
-	void StringParam::operator=(const std::string &value) {
-		set_value(value, ParamUtils::get_current_application_default_param_source_type(), nullptr);
-	}
-
-	template<>
-	void StringParam::operator=(const std::string *value) {
-		set_value((value == nullptr ? "" : *value), ParamUtils::get_current_application_default_param_source_type(), nullptr);
-	}
-
-	template<>
-	void StringParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source) {
-		unsigned int pos = 0;
-		std::string vs(v == nullptr ? "" : v);
-		std::string vv;
-		reset_fault();
-		on_parse_f_(*this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
-		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
-		if (!has_faulted()) {
-			set_value(vv, source_type, source);
-		}
-	}
-
 	template <>
-	void StringParam::set_value(const std::string &val, ParamSetBySourceType source_type, ParamPtr source) {
-		safe_inc(access_counts_.writing);
+	void StringParam::set_value(std::string &&val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		count_write(PARAM_CALL_SITE_ONLY_ARG);
 		// ^^^^^^^ --
 		// Our 'writing' statistic counts write ATTEMPTS, in reailty.
 		// Any real change is tracked by the 'changing' statistic (see further below)!
 
-		std::string value(val);
+		std::string value(std::move(val));
 		reset_fault();
 		// when we fail the validation horribly, the validator will throw an exception and thus abort the (write) action.
 		// non-fatal errors may be signaled, in which case the write operation is aborted/skipped, or not signaled (a.k.a. 'silent')
 		// in which case the write operation proceeds as if nothing untoward happened inside on_validate_f.
-		on_validate_f_(*this, value_, value, default_, source_type);
+		call_handler(ON_VALIDATE_HANDLER, on_validate_f_, *this, value_, value, default_, source_type);
 		if (!has_faulted()) {
 			// however, when we failed the validation only in the sense of the value being adjusted/restricted by the validator,
 			// then we must set the value as set by the validator anyway, so nothing changes in our workflow here.
@@ -199,19 +176,54 @@ namespace parameters {
 			set_to_non_default_value_ = (value != default_);
 
 			if (value != value_) {
-				on_modify_f_(*this, value_, value, default_, source_type, source);
+				call_handler(ON_MODIFY_HANDLER, on_modify_f_, *this, value_, value, default_, source_type, source);
 				if (!has_faulted() && value != value_) {
-					safe_inc(access_counts_.changing);
-					value_ = value;
+					note_value_change();
+					count_access(access_counts_.changing);
+					value_ = std::move(value);
 				}
 			}
 		}
 		// any signaled fault will be visible outside...
 	}
 
+	template<>
+	void StringParam::operator=(const std::string &value) {
+		set_value(value, ParamUtils::get_current_application_default_param_source_type(), nullptr);
+	}
+
+	template<>
+	void StringParam::operator=(std::string &&value) {
+		set_value(std::move(value), ParamUtils::get_current_application_default_param_source_type(), nullptr);
+	}
+
+	template<>
+	void StringParam::operator=(const std::string *value) {
+		set_value((value == nullptr ? "" : *value), ParamUtils::get_current_application_default_param_source_type(), nullptr);
+	}
+
+	template<>
+	void StringParam::set_value(const char *v, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		unsigned int pos = 0;
+		std::string vs(v == nullptr ? "" : v);
+		std::string vv;
+		reset_fault();
+		call_handler(ON_PARSE_HANDLER, on_parse_f_, *this, vv, vs, pos, source_type); // minor(=recoverable) errors shall have signalled by calling fault()
+		// when a signaled parse error occurred, we won't write the (faulty/undefined) value:
+		if (!has_faulted()) {
+			set_value(std::move(vv), source_type, source PARAM_CALL_SITE_ARG);
+		}
+	}
+
+	template <>
+	void StringParam::set_value(const std::string &val, ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
+		// copy once, then take the move path.
+		set_value(std::string(val), source_type, source PARAM_CALL_SITE_ARG);
+	}
+
 	template <>
-	const std::string &StringParam::value() const noexcept {
-		safe_inc(access_counts_.reading);
+	const std::string &StringParam::value(PARAM_CALL_SITE_ONLY_PARAM) const noexcept {
+		count_read(PARAM_CALL_SITE_ONLY_ARG);
 		return value_;
 	}
 
@@ -234,8 +246,8 @@ namespace parameters {
 	template<>
 	std::string StringParam::value_str(ValueFetchPurpose purpose) const {
 		if (purpose == VALSTR_PURPOSE_DATA_4_USE)
-			safe_inc(access_counts_.reading);
-		return on_format_f_(*this, value_, default_, purpose);
+			count_access(access_counts_.reading);
+		return call_handler(ON_FORMAT_HANDLER, on_format_f_, *this, value_, default_, purpose);
 	}
 
 	template<>
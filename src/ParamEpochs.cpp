@@ -0,0 +1,209 @@
+
+#include <parameters/parameters.h>
+
+#include "internal_helpers.hpp"
+#include "logchannel_helpers.hpp"
+#include "os_platform_helpers.hpp"
+
+#include <thread>
+#include <unordered_set>
+
+
+namespace parameters {
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// ParamsEpoch
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	static std::atomic<uint64_t> last_issued_epoch_serial{0};
+
+	std::unique_ptr<const ParamsEpoch> ParamsEpoch::Capture(const ParamsVectorSet *globals, const ParamsVectorSet *locals) {
+		std::unique_ptr<ParamsEpoch> epoch(new ParamsEpoch());
+		for (const ParamsVectorSet *set : {locals, globals}) {
+			if (!set)
+				continue;
+			for (ParamPtr p : set->as_list()) {
+				// locals take precedence over globals, just like they do with the find() functions.
+				if (!epoch->values_.contains(p))
+					epoch->values_.emplace(p, SnapshotValues::CurrentValue(p));
+			}
+		}
+		epoch->serial_ = ++last_issued_epoch_serial;
+		return epoch;
+	}
+
+	const SnapshotValue &ParamsEpoch::fetch(const Param &param) const {
+		auto l = values_.find(&param);
+		if (l == values_.end()) {
+			throw new std::logic_error(fmt::format("{} param '{}' error: the parameter is not part of the configuration epoch.", ParamUtils::GetApplicationName(), param.name_str()));
+		}
+		return l->second;
+	}
+
+	int32_t ParamsEpoch::value(const IntParam &param) const {
+		return std::get<int32_t>(fetch(param));
+	}
+
+	bool ParamsEpoch::value(const BoolParam &param) const {
+		return std::get<bool>(fetch(param));
+	}
+
+	double ParamsEpoch::value(const DoubleParam &param) const {
+		return std::get<double>(fetch(param));
+	}
+
+	const std::string &ParamsEpoch::value(const StringParam &param) const {
+		return std::get<std::string>(fetch(param));
+	}
+
+	const SnapshotValue *ParamsEpoch::find(const Param &param) const noexcept {
+		auto l = values_.find(&param);
+		return (l != values_.end() ? &l->second : nullptr);
+	}
+
+	bool ParamsEpoch::contains(const Param &param) const noexcept {
+		return values_.contains(&param);
+	}
+
+	size_t ParamsEpoch::size() const noexcept {
+		return values_.size();
+	}
+
+	uint64_t ParamsEpoch::serial() const noexcept {
+		return serial_;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// ParamsEpochPublisher
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// marks a reader slot which has been claimed, but does not (yet) protect any epoch.
+	static const ParamsEpoch *const claimed_slot = reinterpret_cast<const ParamsEpoch *>(uintptr_t(1));
+
+	ParamsEpochPublisher::ParamsEpochPublisher()
+		: current_(nullptr)
+	{
+		for (auto &slot : slots_) {
+			slot.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	ParamsEpochPublisher::~ParamsEpochPublisher() {
+		delete current_.load();
+		for (const ParamsEpoch *epoch : retired_) {
+			delete epoch;
+		}
+		retired_.clear();
+	}
+
+	ParamsEpochPublisher::ReadGuard::ReadGuard(const ParamsEpochPublisher &publisher)
+		: publisher_(&publisher),
+		slot_(0),
+		epoch_(nullptr)
+	{
+		// Each thread starts probing for a free slot at a different offset, so concurrent readers don't contend for the same slots.
+		static std::atomic<size_t> next_slot_hint{0};
+		thread_local size_t hint = next_slot_hint.fetch_add(1, std::memory_order_relaxed);
+
+		for (size_t i = 0;; i++) {
+			size_t index = (hint + i) % MAX_READERS;
+			auto &slot = publisher.slots_[index];
+			const ParamsEpoch *expected = nullptr;
+			if (slot.load(std::memory_order_relaxed) == nullptr && slot.compare_exchange_strong(expected, claimed_slot, std::memory_order_acquire)) {
+				slot_ = index;
+				break;
+			}
+			if (i % MAX_READERS == MAX_READERS - 1) {
+				// all slots are in use: wait for another reader to finish.
+				std::this_thread::yield();
+			}
+		}
+
+		// Protect the epoch, then check it is still the current one: when it is, any writer retiring it afterwards
+		// is guaranteed to see our slot when it scans for pinned epochs.
+		auto &slot = publisher.slots_[slot_];
+		const ParamsEpoch *epoch = publisher.current_.load(std::memory_order_acquire);
+		for (;;) {
+			slot.store(epoch ? epoch : claimed_slot, std::memory_order_seq_cst);
+			const ParamsEpoch *check = publisher.current_.load(std::memory_order_seq_cst);
+			if (check == epoch)
+				break;
+			epoch = check;
+		}
+		epoch_ = epoch;
+	}
+
+	ParamsEpochPublisher::ReadGuard::ReadGuard(ReadGuard &&o) noexcept
+		: publisher_(o.publisher_),
+		slot_(o.slot_),
+		epoch_(o.epoch_)
+	{
+		o.publisher_ = nullptr;
+		o.epoch_ = nullptr;
+	}
+
+	ParamsEpochPublisher::ReadGuard::~ReadGuard() {
+		release();
+	}
+
+	void ParamsEpochPublisher::ReadGuard::release() noexcept {
+		if (publisher_ == nullptr)
+			return;
+		publisher_->slots_[slot_].store(nullptr, std::memory_order_release);
+		publisher_ = nullptr;
+		epoch_ = nullptr;
+	}
+
+	ParamsEpochPublisher::ReadGuard ParamsEpochPublisher::Pin() const {
+		return ReadGuard(*this);
+	}
+
+	void ParamsEpochPublisher::Publish(std::unique_ptr<const ParamsEpoch> epoch) {
+		std::lock_guard<std::mutex> lock(writer_lock_);
+		const ParamsEpoch *old = current_.exchange(epoch.release(), std::memory_order_seq_cst);
+		if (old) {
+			retired_.push_back(old);
+		}
+		ReclaimUnpinned();
+	}
+
+	void ParamsEpochPublisher::Publish(const ParamsVectorSet *globals, const ParamsVectorSet *locals) {
+		Publish(ParamsEpoch::Capture(globals, locals));
+	}
+
+	void ParamsEpochPublisher::Reclaim() {
+		std::lock_guard<std::mutex> lock(writer_lock_);
+		ReclaimUnpinned();
+	}
+
+	size_t ParamsEpochPublisher::RetiredCount() const {
+		std::lock_guard<std::mutex> lock(writer_lock_);
+		return retired_.size();
+	}
+
+	void ParamsEpochPublisher::ReclaimUnpinned() {
+		if (retired_.empty())
+			return;
+
+		std::unordered_set<const ParamsEpoch *> pinned;
+		for (const auto &slot : slots_) {
+			const ParamsEpoch *epoch = slot.load(std::memory_order_seq_cst);
+			if (epoch != nullptr && epoch != claimed_slot)
+				pinned.insert(epoch);
+		}
+
+		size_t kept = 0;
+		for (const ParamsEpoch *epoch : retired_) {
+			if (pinned.contains(epoch))
+				retired_[kept++] = epoch;
+			else
+				delete epoch;
+		}
+		retired_.resize(kept);
+	}
+
+}	// namespace
@@ -70,7 +70,10 @@ namespace parameters {
 
 	void ParamsVector::add(ParamPtr param_ref) {
 		check_and_report_name_collisions(param_ref->name_str(), params_);
-		params_.insert({param_ref->name_str(), param_ref});
+		auto rv = params_.insert({param_ref->name_str(), param_ref});
+		if (rv.second && &param_ref->owner() != this)
+			untracked_params_++;
+		sorted_params_valid_ = false;
 	}
 
 	void ParamsVector::add(Param &param_ref) {
@@ -86,7 +89,24 @@ namespace parameters {
 	void ParamsVector::remove(const char *name) {
 		if (!name || !*name)
 			return;
-		params_.erase(name);
+		auto l = params_.find(name);
+		if (l == params_.end())
+			return;
+		ParamPtr p = (*l).second;
+		if (&p->owner() != this) {
+			untracked_params_--;
+		} else {
+			// the parameter will keep registering its accesses with us, while we won't be reporting on it any more.
+			unlink_touched(p);
+			untracked_params_++;
+		}
+		for (ParamsSectionRecord &record : section_history_) {
+			std::erase_if(record.counts, [p](const ParamSectionCounts &c) {
+				return c.param == p;
+			});
+		}
+		params_.erase(l);
+		sorted_params_valid_ = false;
 	}
 
 	void ParamsVector::remove(ParamPtr param_ref) {
@@ -162,6 +182,152 @@ namespace parameters {
 		return lst;
 	}
 
+	// report order: 'init' parameters first, 'debug' parameters last, ordered by name otherwise.
+	bool ParamsVector::report_order_less(const ParamPtr &a, const ParamPtr &b) {
+		if (a->is_init() != b->is_init())
+			return a->is_init();
+		if (a->is_debug() != b->is_debug())
+			return b->is_debug();
+		int rv = strcmp(a->name_str(), b->name_str());
+#if !defined(NDEBUG)
+		if (rv == 0 && a != b) {
+			LIBASSERT_PANIC(fmt::format("Apparently you have double-defined a {} Variable: '{}'! Fix that in the source code!\n", ParamUtils::GetApplicationName(), a->name_str()).c_str());
+		}
+#endif
+		return rv < 0;
+	}
+
+	const std::vector<ParamPtr> &ParamsVector::sorted_list() const {
+		if (!sorted_params_valid_) {
+			sorted_params_.clear();
+			sorted_params_.reserve(params_.size());
+			for (auto i : params_) {
+				sorted_params_.push_back(i.second);
+			}
+			std::sort(sorted_params_.begin(), sorted_params_.end(), report_order_less);
+			sorted_params_valid_ = true;
+		}
+		return sorted_params_;
+	}
+
+	void ParamsVector::push_touched(Param *p) const noexcept {
+		std::atomic_ref<Param *> head(touched_head_);
+		Param *next = head.load(std::memory_order_relaxed);
+		do {
+			p->next_touched_ = next;
+		} while (!head.compare_exchange_weak(next, p, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	void ParamsVector::unlink_touched(Param *p) {
+		// Other threads may push parameters onto the list concurrently, but those only ever replace the head: the links
+		// between the nodes already in the list remain untouched, so we can safely unlink any node but the head.
+		std::atomic_ref<Param *> head(touched_head_);
+		Param *first = p;
+		if (!head.compare_exchange_strong(first, p->next_touched_, std::memory_order_acq_rel, std::memory_order_acquire)) {
+			Param *prev = first;
+			while (prev != nullptr && prev->next_touched_ != p)
+				prev = prev->next_touched_;
+			if (prev == nullptr)
+				return;
+			prev->next_touched_ = p->next_touched_;
+		}
+		if (touched_collected_ == p)
+			touched_collected_ = p->next_touched_;
+		std::erase(touched_params_, p);
+		p->next_touched_ = nullptr;
+		p->touched_.store(false, std::memory_order_relaxed);
+	}
+
+	const std::vector<ParamPtr> &ParamsVector::touched_list() {
+		// collect the parameters registered since the previous invocation: those are at the front of the linked list.
+		Param *first = std::atomic_ref<Param *>(touched_head_).load(std::memory_order_acquire);
+		if (first != touched_collected_) {
+			for (Param *p = first; p != touched_collected_; p = p->next_touched_) {
+				touched_params_.push_back(p);
+			}
+			touched_collected_ = first;
+			// the order in which the parameters got registered is of no importance.
+			std::sort(touched_params_.begin(), touched_params_.end(), report_order_less);
+		}
+		return touched_params_;
+	}
+
+	bool ParamsVector::tracks_all_accesses() const noexcept {
+		return untracked_params_ == 0;
+	}
+
+	// record the section's counts of a parameter in the section history record, then fold them into the parameter's run totals.
+	static inline void record_and_reset_access_counts(ParamsSectionRecord *record, ParamPtr p) {
+		if (record) {
+			const auto &counts = p->access_counts();
+			if (counts.reading | counts.writing | counts.changing | counts.faulting) {
+				record->counts.push_back({p, counts.reading, counts.writing, counts.changing, counts.faulting});
+			}
+		}
+		p->reset_access_counts();
+	}
+
+	void ParamsVector::reset_access_counts(bool record_history) {
+		ParamsSectionRecord *record = nullptr;
+		if (record_history)
+			section_count_++;
+		if (record_history && section_history_depth_ > 0) {
+			// recycle the oldest record, when we're at capacity, so its storage is reused.
+			if (section_history_.size() >= section_history_depth_) {
+				section_history_.push_back(std::move(section_history_.front()));
+				section_history_.pop_front();
+				section_history_.back().counts.clear();
+			} else {
+				section_history_.emplace_back();
+			}
+			record = &section_history_.back();
+			record->section = section_count_;
+		}
+
+		// detach the dirty set: parameters accessed from here on register themselves in a fresh list.
+		Param *first = std::atomic_ref<Param *>(touched_head_).exchange(nullptr, std::memory_order_acq_rel);
+		if (tracks_all_accesses()) {
+			for (Param *p = first; p != nullptr; p = p->next_touched_) {
+				record_and_reset_access_counts(record, p);
+			}
+		} else {
+			for (auto i : params_) {
+				record_and_reset_access_counts(record, i.second);
+			}
+		}
+		for (Param *p = first; p != nullptr; ) {
+			Param *next = p->next_touched_;
+			p->next_touched_ = nullptr;
+			p->touched_.store(false, std::memory_order_release);
+			p = next;
+		}
+		touched_params_.clear();
+		touched_collected_ = nullptr;
+	}
+
+	void ParamsVector::set_section_history_depth(size_t depth) {
+		section_history_depth_ = depth;
+		while (section_history_.size() > depth) {
+			section_history_.pop_front();
+		}
+	}
+
+	const std::deque<ParamsSectionRecord> &ParamsVector::section_history() const noexcept {
+		return section_history_;
+	}
+
+	void ParamsVector::track_access_times(bool enable) {
+		for (auto i : params_) {
+			i.second->track_access_times(enable);
+		}
+	}
+
+	void ParamsVector::track_handler_timings(bool enable) {
+		for (auto i : params_) {
+			i.second->track_handler_timings(enable);
+		}
+	}
+
 	const char* ParamsVector::title() const {
 		return title_.c_str();
 	}
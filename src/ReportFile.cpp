@@ -5,6 +5,11 @@
 #include "logchannel_helpers.hpp"
 #include "os_platform_helpers.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 
 namespace parameters {
 
@@ -14,10 +19,11 @@ namespace parameters {
 	//
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	// predefined formatters for the two predefined report types:
+	// predefined formatters for the predefined report types:
 	//
 	//		PARAMREPORT_AS_MARKDOWN_REPORT
 	//		PARAMREPORT_AS_CONFIGFILE
+	//		PARAMREPORT_AS_JSON, PARAMREPORT_AS_JSON_LINES
 	//
 	// We also provide a bare bones formatter for the custom userland format (PARAMREPORT_CUSTOM_OUTPUT), in case the userland code forgets to specify one.
 	//
@@ -29,6 +35,11 @@ namespace parameters {
 
 	}
 
+	// the JSON records are produced by the ReportWriter itself, so there's nothing left to do here.
+	static void json_reformatLine(CString<> &line_buffer, size_t line_start_pos, ReportWriter::ReportType target, ReportWriter::LineContentPurpose purpose, int level /* starts at level 1 */, const Param *param) {
+
+	}
+
 	static void dummy_userland_report_reformatLine(CString<> &line_buffer, size_t line_start_pos, ReportWriter::ReportType target, ReportWriter::LineContentPurpose purpose, int level /* starts at level 1 */, const Param *param) {
 
 	}
@@ -44,6 +55,139 @@ namespace parameters {
 
 		case ReportWriter::PARAMREPORT_AS_CONFIGFILE:
 			return configfile_reformatLine;
+
+		case ReportWriter::PARAMREPORT_AS_JSON:
+		case ReportWriter::PARAMREPORT_AS_JSON_LINES:
+			return json_reformatLine;
+		}
+	}
+
+	static void append_json_string(CString<> &dst, const char *str, size_t len) {
+		static const char hexdigits[] = "0123456789abcdef";
+
+		dst.append('"');
+		for (size_t i = 0; i < len; i++) {
+			unsigned char c = str[i];
+			switch (c) {
+			case '"':
+				dst.append("\\\"");
+				break;
+			case '\\':
+				dst.append("\\\\");
+				break;
+			case '\n':
+				dst.append("\\n");
+				break;
+			case '\r':
+				dst.append("\\r");
+				break;
+			case '\t':
+				dst.append("\\t");
+				break;
+			default:
+				if (c < 0x20) {
+					dst.append("\\u00");
+					dst.append(hexdigits[c >> 4]);
+					dst.append(hexdigits[c & 0x0F]);
+				} else {
+					// UTF-8 sequences are passed on as-is.
+					dst.append(char(c));
+				}
+				break;
+			}
+		}
+		dst.append('"');
+	}
+
+	static inline void append_json_string(CString<> &dst, const std::string &str) {
+		append_json_string(dst, str.c_str(), str.size());
+	}
+
+	static inline void append_json_string(CString<> &dst, const char *str) {
+		append_json_string(dst, str, str ? strlen(str) : 0);
+	}
+
+	// check whether the string is a valid JSON number, i.e. matches  -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+	static bool is_json_number(const std::string &str) {
+		const char *s = str.c_str();
+		if (*s == '-')
+			s++;
+		if (*s == '0') {
+			s++;
+		} else if (isdigit((unsigned char)*s)) {
+			while (isdigit((unsigned char)*s))
+				s++;
+		} else {
+			return false;
+		}
+		if (*s == '.') {
+			s++;
+			if (!isdigit((unsigned char)*s))
+				return false;
+			while (isdigit((unsigned char)*s))
+				s++;
+		}
+		if (*s == 'e' || *s == 'E') {
+			s++;
+			if (*s == '+' || *s == '-')
+				s++;
+			if (!isdigit((unsigned char)*s))
+				return false;
+			while (isdigit((unsigned char)*s))
+				s++;
+		}
+		return *s == 0;
+	}
+
+	// numeric and boolean values are reported as JSON numbers and booleans, when their raw text representation allows;
+	// everything else, including NaN and Inf, is reported as a string carrying the raw (parseable) value.
+	static void append_json_value(CString<> &dst, ParamType type, const std::string &value) {
+		switch (type) {
+		case INT_PARAM:
+		case DOUBLE_PARAM:
+			if (is_json_number(value)) {
+				dst.append(value.c_str(), value.size());
+				return;
+			}
+			break;
+
+		case BOOL_PARAM:
+			if (value == "true" || value == "false") {
+				dst.append(value.c_str(), value.size());
+				return;
+			}
+			break;
+
+		default:
+			break;
+		}
+		append_json_string(dst, value);
+	}
+
+	static const char *set_mode_as_str(ParamSetBySourceType mode) {
+		switch (mode) {
+		case PARAM_VALUE_IS_DEFAULT:
+			return "default";
+		case PARAM_VALUE_IS_RESET:
+			return "reset";
+		case PARAM_VALUE_IS_SET_BY_PRESET:
+			return "preset";
+		case PARAM_VALUE_IS_SET_BY_CONFIGFILE:
+			return "configfile";
+		case PARAM_VALUE_IS_SET_BY_COMMANDLINE:
+			return "commandline";
+		case PARAM_VALUE_IS_SET_BY_ASSIGN:
+			return "assign";
+		case PARAM_VALUE_IS_SET_BY_PARAM:
+			return "param";
+		case PARAM_VALUE_IS_SET_BY_APPLICATION:
+			return "application";
+		case PARAM_VALUE_IS_SET_BY_CORE_RUN:
+			return "core_run";
+		case PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND:
+			return "snapshot_rewind";
+		default:
+			return "unknown";
 		}
 	}
 
@@ -51,12 +195,16 @@ namespace parameters {
 		: _postprocessor(pick_default_formatter_for_given_target(target))
 		, _active_level(0)
 		, _type(target)
+		, _json_record_count(0)
+		, _json_closed(false)
 	{}
 
 	ReportWriter::ReportWriter(reformatLine_f *custom_postprocessor, ReportType target)
 		: _postprocessor(custom_postprocessor != nullptr ? custom_postprocessor : pick_default_formatter_for_given_target(target))
 		, _active_level(0)
 		, _type(target)
+		, _json_record_count(0)
+		, _json_closed(false)
 	{}
 
 	ReportWriter::~ReportWriter() {
@@ -70,6 +218,12 @@ namespace parameters {
 
 
 	void ReportWriter::WriteParamInfoLine(const Param &param, ParamInfoElement show_elements) {
+		if (IsJSONOutput()) {
+			const auto &counts = param.access_counts();
+			WriteParamRecord(param, counts.writing, counts.reading, counts.changing, counts.faulting, (show_elements & PARAMINFO_DESCRIPTION) != 0);
+			return;
+		}
+
 		size_t start_pos = _buffer.get_current_shift();
 		switch (int(show_elements)) {
 		case 0:
@@ -181,6 +335,17 @@ namespace parameters {
 
 	void ReportWriter::WriteHeaderLine(const std::string &message, int level /* starts at level 1 */) {
 		_active_level = level;
+
+		if (IsJSONOutput()) {
+			_active_heading = message;
+			size_t start_pos = BeginJSONRecord();
+			Format("{{\"record\":\"heading\",\"level\":{},\"title\":", level);
+			append_json_string(_buffer, message);
+			_buffer.append('}');
+			EndJSONRecord(PARAMREPORT_HEADING, start_pos);
+			return;
+		}
+
 		size_t start_pos = _buffer.get_current_shift();
 
 		for (;level > 0; level--) {
@@ -193,6 +358,11 @@ namespace parameters {
 	}
 
 	void ReportWriter::WriteInfoParagraph(const std::string &message) {
+		if (IsJSONOutput()) {
+			WriteOther(PARAMREPORT_INFO_PARAGRAPH, message);
+			return;
+		}
+
 		size_t start_pos = _buffer.get_current_shift();
 		_buffer.append(message);
 
@@ -200,18 +370,111 @@ namespace parameters {
 	}
 
 	void ReportWriter::WriteOther(LineContentPurpose purpose, const std::string &message) {
+		if (IsJSONOutput()) {
+			// the legenda explains the markdown table notation, which is of no use to JSON consumers.
+			if (purpose == PARAMREPORT_TABLE_LEGENDA)
+				return;
+			size_t start_pos = BeginJSONRecord();
+			Append("{\"record\":\"info\",\"text\":");
+			append_json_string(_buffer, message);
+			_buffer.append('}');
+			EndJSONRecord(purpose, start_pos);
+			return;
+		}
+
 		size_t start_pos = _buffer.get_current_shift();
 		_buffer.append(message);
 
 		_postprocessor(_buffer, start_pos, _type, purpose, _active_level, nullptr);
 	}
 
+	void ReportWriter::EndLine(LineContentPurpose purpose, size_t line_start_pos, const Param *param) {
+		_postprocessor(_buffer, line_start_pos, _type, purpose, _active_level, param);
+
+		if (_buffer.length() >= FLUSH_THRESHOLD) {
+			WriteLineBuffer();
+		}
+	}
+
+	void ReportWriter::WriteParamRecord(const Param &param, int64_t writing, int64_t reading, int64_t changing, int64_t faulting, bool with_description) {
+		size_t start_pos = BeginJSONRecord();
+		Append("{\"record\":\"param\",\"section\":");
+		append_json_string(_buffer, _active_heading);
+		Append(",\"name\":");
+		append_json_string(_buffer, param.name_str());
+		Append(",\"type\":");
+		append_json_string(_buffer, param.raw_value_type_str());
+		Append(",\"value\":");
+		append_json_value(_buffer, param.type(), param.raw_value_str());
+		Append(",\"default\":");
+		append_json_value(_buffer, param.type(), param.raw_default_value_str());
+		Format(",\"set_mode\":\"{}\",\"init\":{},\"debug\":{},\"non_default\":{},\"locked\":{}",
+			set_mode_as_str(param.set_mode()), param.is_init(), param.is_debug(), param.is_set_to_non_default_value(), param.is_locked());
+		if (with_description) {
+			Append(",\"info\":");
+			append_json_string(_buffer, param.info_str());
+		}
+		if (writing >= 0)
+			Format(",\"writes\":{}", writing);
+		if (reading >= 0)
+			Format(",\"reads\":{}", reading);
+		if (changing >= 0)
+			Format(",\"changes\":{}", changing);
+		if (faulting >= 0)
+			Format(",\"faults\":{}", faulting);
+		// access timestamps, in milliseconds since application start; omitted when not tracked or when the event never happened.
+		const Param::access_times_t *times = param.access_times();
+		if (times) {
+			if (times->first_read)
+				Format(",\"first_read_ms\":{:.3f}", times->first_read / 1.0e6);
+			if (times->last_read)
+				Format(",\"last_read_ms\":{:.3f}", times->last_read / 1.0e6);
+			if (times->last_change)
+				Format(",\"last_change_ms\":{:.3f}", times->last_change / 1.0e6);
+		}
+		_buffer.append('}');
+		EndJSONRecord(PARAMREPORT_ITEM_LIST, start_pos, &param);
+	}
+
+	size_t ReportWriter::BeginJSONRecord() {
+		size_t start_pos = BeginLine();
+		if (_type == PARAMREPORT_AS_JSON) {
+			_buffer.append(_json_record_count == 0 ? "[\n" : ",\n");
+		}
+		_json_record_count++;
+		return start_pos;
+	}
+
+	void ReportWriter::EndJSONRecord(LineContentPurpose purpose, size_t line_start_pos, const Param *param) {
+		if (_type == PARAMREPORT_AS_JSON_LINES) {
+			_buffer.append('\n');
+		}
+		EndLine(purpose, line_start_pos, param);
+	}
+
+	void ReportWriter::AppendJSONString(const char *str) {
+		append_json_string(_buffer, str);
+	}
+
+	void ReportWriter::AppendJSONString(const std::string &str) {
+		append_json_string(_buffer, str);
+	}
+
+	void ReportWriter::CloseJSONDocument() {
+		if (!IsJSONOutput() || _json_closed)
+			return;
+		_json_closed = true;
+		if (_type == PARAMREPORT_AS_JSON) {
+			_buffer.append(_json_record_count == 0 ? "[]\n" : "\n]\n");
+		}
+	}
+
 	void ReportWriter::WriteLineBuffer() {
 		// nada. zilch.
 	}
 
 	void ReportWriter::Finalize() {
-		// nada. zilch.
+		CloseJSONDocument();
 
 		_postprocessor(_buffer, 0, _type, PARAMREPORT_TERMINATION_AKA_THE_END, _active_level, nullptr);
 	}
@@ -255,7 +518,84 @@ namespace parameters {
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	// permanent lookup table:
-	std::vector<std::string> StdioReportWriter::_processed_file_paths;
+	std::unordered_set<std::string> StdioReportWriter::_processed_file_paths;
+	static std::mutex processed_file_paths_lock;
+
+
+	// The background writer of an async StdioReportWriter: the report producer fills the writer's line buffer, while
+	// this one writes the previously handed-off buffer to the file. Buffers are exchanged, not copied.
+	struct StdioReportWriter::AsyncDrain {
+		FILE *f;
+		const std::string &path;
+
+		std::mutex lock;
+		std::condition_variable signal;
+		CString<> pending;
+		bool has_pending = false;
+		bool stop = false;
+		bool errored = false;
+
+		std::thread worker;
+
+		AsyncDrain(FILE *file, const std::string &file_path)
+			: f(file)
+			, path(file_path)
+		{
+			worker = std::thread([this]() {
+				run();
+			});
+		}
+
+		~AsyncDrain() {
+			finish();
+		}
+
+		// Wait for the background writer to complete all pending output and terminate. Returns false when any write failed.
+		bool finish() {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				stop = true;
+			}
+			signal.notify_all();
+			if (worker.joinable())
+				worker.join();
+			return !errored;
+		}
+
+		void run() {
+			std::unique_lock<std::mutex> guard(lock);
+			for (;;) {
+				signal.wait(guard, [this]() {
+					return has_pending || stop;
+				});
+				if (!has_pending)
+					break;
+
+				// the producer won't touch the pending buffer until we signal we're done with it, so we can write without holding the lock.
+				guard.unlock();
+				if (!errored) {
+					errored = !write_to_file(f, path, pending.c_str(), pending.length());
+				}
+				pending.clear();
+				guard.lock();
+				has_pending = false;
+				signal.notify_all();
+			}
+		}
+
+		static bool write_to_file(FILE *f, const std::string &path, const char *data, size_t length) {
+			size_t w = fwrite(data, 1, length, f);
+			if (w != length) {
+				if (ferror(f)) {
+					PARAM_ERROR("Failed to write to file '{}': {}\n", path, strerror(errno));
+				} else {
+					PARAM_ERROR("Failed to write to file '{}': unidentified error (disk full?)\n", path);
+				}
+				return false;
+			}
+			return true;
+		}
+	};
 
 
 	StdioReportWriter::StdioReportWriter(const char *path, ReportType target)
@@ -284,23 +624,26 @@ namespace parameters {
 			_f = stderr;
 			_canonical_filepath = "/dev/stderr";
 		} else {
-			bool first = true;
 			fs::path p = fs::weakly_canonical(path);
 			std::u8string p8 = p.u8string();
 			_canonical_filepath = reinterpret_cast<const char *>(p8.c_str());
-			for (std::string &i : _processed_file_paths) {
-				if (strieq(i.c_str(), _canonical_filepath.c_str())) {
-					first = false;
-					break;
-				}
-			}
+
+			// paths are compared case-insensitively:
+			std::string key = _canonical_filepath;
+			std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
+				return char(tolower(c));
+			});
+
+			// hold the lock while opening the file, so concurrent writers to the same path agree on who gets to overwrite it.
+			std::lock_guard<std::mutex> guard(processed_file_paths_lock);
+			bool first = !_processed_file_paths.contains(key);
 			const char *mode = (first ? "w" : "a");
 			_f = fopen(_canonical_filepath.c_str(), mode);
 			if (!_f) {
 				PARAM_ERROR("Cannot produce report/output file: {}\n", _canonical_filepath);
 				_errored = true;
 			} else if (first) {
-				_processed_file_paths.push_back(_canonical_filepath.c_str());
+				_processed_file_paths.insert(std::move(key));
 			}
 		}
 	}
@@ -315,39 +658,66 @@ namespace parameters {
 	}
 
 
+	void StdioReportWriter::EnableAsyncOutput() {
+		if (!_f || _async)
+			return;
+		_async.reset(new AsyncDrain(_f, _canonical_filepath));
+	}
+
+
 	void StdioReportWriter::WriteLineBuffer() {
-		size_t sl = _buffer.length();
-		size_t w = fwrite(_buffer.c_str(), 1, sl, _f);
-		if (w != sl) {
+		if (!_f) {
+			// no output file: report via the log channel instead.
+			PARAM_INFO("{}", _buffer.c_str());
+			_buffer.clear();
+			return;
+		}
+		if (_async) {
+			// wait for the background writer to finish the previous buffer, then swap: it gets our content, we get its empty buffer.
+			std::unique_lock<std::mutex> guard(_async->lock);
+			_async->signal.wait(guard, [this]() {
+				return !_async->has_pending;
+			});
+			_buffer.swap(_async->pending);
+			_async->has_pending = true;
+			guard.unlock();
+			_async->signal.notify_all();
+			return;
+		}
+		if (!AsyncDrain::write_to_file(_f, _canonical_filepath, _buffer.c_str(), _buffer.length())) {
 			_errored = true;
-			if (ferror(_f)) {
-				PARAM_ERROR("Failed to write to file '{}': {}\n", _canonical_filepath, strerror(errno));
-			} else {
-				PARAM_ERROR("Failed to write to file '{}': unidentified error (disk full?)\n", _canonical_filepath);
-			}
 		}
 		_buffer.clear();
 	}
 
 
 	void StdioReportWriter::Finalize() {
+		CloseJSONDocument();
+
 		if (!_errored) {
 			if (!_buffer.empty()) {
 				WriteLineBuffer();
 			}
 		}
 
+		if (_async) {
+			// the background writer completes all pending output before it terminates, so the file is closed after the last write.
+			if (!_async->finish())
+				_errored = true;
+			_async.reset();
+		}
+
 		if (_f) {
 			clearerr(_f);
+			int rv;
 			if (_f != stdout && _f != stderr) {
-				fclose(_f);
+				rv = fclose(_f);
 			} else {
-				fflush(_f);
+				rv = fflush(_f);
 			}
-			if (ferror(_f)) {
+			if (rv != 0) {
 				PARAM_ERROR("Failed to complete writing to file '{}': {}\n", _canonical_filepath, strerror(errno));
-			} else {
-				PARAM_ERROR("Failed to complate writing to file '{}': unidentified error (disk full?)\n", _canonical_filepath);
+				_errored = true;
 			}
 		}
 		_f = nullptr;
@@ -5,61 +5,91 @@
 #include "logchannel_helpers.hpp"
 #include "os_platform_helpers.hpp"
 
+#include <chrono>
+#include <unordered_map>
+
 
 namespace parameters {
 
-	template<typename T>
-	static inline int sign_of_diff(T a, T b) {
-		if (a == b)
-			return 0;
-		if (a < b)
-			return -1;
-		return 1;
+	static inline int acc(uint64_t access) {
+		if (access > 2)
+			access = 2;
+		return int(access);
 	}
 
-	static inline const char *type_as_str(ParamType type) {
-		switch (type) {
-		case INT_PARAM:
-			return "[Integer]";
-		case BOOL_PARAM:
-			return "[Boolean]";
-		case DOUBLE_PARAM:
-			return "[Float]";
-		case STRING_PARAM:
-			return "[String]";
-
-		case INT_SET_PARAM:
-			return "[Arr:Int]";
-		case BOOL_SET_PARAM:
-			return "[Arr:Bool]";
-		case DOUBLE_SET_PARAM:
-			return "[Arr:Flt]";
-		case STRING_SET_PARAM:
-			return "[Arr:Str]";
-
-		case CUSTOM_PARAM:
-			return "[Custom]";
-		case CUSTOM_SET_PARAM:
-			return "[Arr:Cust]";
-
-		case ANY_TYPE_PARAM:
-			return "[ANY]";
+	static const char* sections[] = {"", "(Init)", "(Debug)", "(Init+Dbg)"};
+	static const char* write_access[] = {".", "w", "W"};
+	static const char* read_access[] = {".", "r", "R"};
+
+	// Format the value of a scalar parameter straight into the report writer's buffer, producing the same text as its default
+	// format handler would. Returns false when the parameter is not a scalar or uses a custom format handler: the caller
+	// must then fall back to formatted_value_str().
+	static bool write_scalar_value(ReportWriter &dst, const Param &p) {
+		switch (p.type()) {
+		case INT_PARAM: {
+			const IntParam &ip = static_cast<const IntParam &>(p);
+			if (!ip.has_default_format_handler())
+				return false;
+			dst.Format("{}", ip.raw_value());
+			return true;
+		}
+
+		case BOOL_PARAM: {
+			const BoolParam &bp = static_cast<const BoolParam &>(p);
+			if (!bp.has_default_format_handler())
+				return false;
+			dst.Append(bp.raw_value() ? "true" : "false");
+			return true;
+		}
+
+		case DOUBLE_PARAM: {
+			const DoubleParam &dp = static_cast<const DoubleParam &>(p);
+			if (!dp.has_default_format_handler())
+				return false;
+			// DoubleParam_ParamOnFormatFunction() uses printf("%1.f"):
+			dst.Format("{:.0f}", dp.raw_value());
+			return true;
+		}
 
 		default:
-			return "[???]";
+			return false;
 		}
 	}
 
-	static inline int acc(int access) {
-		if (access > 2)
-			access = 2;
-		return access;
-	}
+	// Stream a single usage report line straight into the report writer's buffer.
+	// The counts are reported exactly: large counts simply widen their column.
+	static void write_usage_report_line(ReportWriter &dst, const Param &p, uint64_t writing, uint64_t reading) {
+		if (dst.IsJSONOutput()) {
+			dst.WriteParamRecord(p, int64_t(writing), int64_t(reading));
+			return;
+		}
 
-	static inline int clip(int access) {
-		if (access > 999)
-			access = 999;
-		return access;
+		size_t start = dst.BeginLine();
+		int section = ((int)p.is_init()) | (2 * (int)p.is_debug());
+		dst.Format("* {:.<60} {:10} ", p.name_str(), sections[section]);
+		if (acc(writing) == 0)
+			dst.Append(".    ");
+		else
+			dst.Format("{}{:4}", write_access[acc(writing)], writing);
+		if (acc(reading) == 0)
+			dst.Append(".    ");
+		else
+			dst.Format("{}{:4}", read_access[acc(reading)], reading);
+		dst.Format(" {:10} = ", type_as_str(p.type()));
+		if (!write_scalar_value(dst, p))
+			dst.Append(p.formatted_value_str());
+		// access timestamps (when tracked), in seconds since application start.
+		const Param::access_times_t *times = p.access_times();
+		if (times && (times->first_read | times->last_change)) {
+			dst.Append("   (");
+			if (times->first_read)
+				dst.Format("read @ {:.3f}s .. {:.3f}s", times->first_read / 1.0e9, times->last_read / 1.0e9);
+			if (times->last_change)
+				dst.Format("{}changed @ {:.3f}s", (times->first_read ? ", " : ""), times->last_change / 1.0e9);
+			dst.Append(")");
+		}
+		dst.Append("\n");
+		dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
 	}
 
 
@@ -79,29 +109,8 @@ namespace parameters {
 
 			dst.WriteHeaderLine(vec->title(), 2);
 
-			// sort the parameters by name, per vectorset / section:
-			std::vector<ParamPtr> params = vec->as_list();
-			std::sort(params.begin(), params.end(), [](const ParamPtr& a, const ParamPtr& b)
-			{
-				int rv = sign_of_diff(a->is_init(), b->is_init());
-				if (rv == 0)
-				{
-					rv = sign_of_diff(b->is_debug(), a->is_debug());
-					if (rv == 0)
-					{
-						rv = strcmp(b->name_str(), a->name_str());
-#if !defined(NDEBUG)
-						if (rv == 0)
-						{
-							LIBASSERT_PANIC(fmt::format("Apparently you have double-defined a {} Variable: '{}'! Fix that in the source code!\n", ParamUtils::GetApplicationName(), a->name_str()).c_str());
-						}
-#endif
-					}
-				}
-				return (rv >= 0);
-			});
-
-			for (ParamPtr param : params) {
+			// the parameters, sorted by name, per vectorset / section:
+			for (ParamPtr param : vec->sorted_list()) {
 				dst.WriteParamInfoLine(param, show_elements_style);
 			}
 		}
@@ -143,165 +152,386 @@ namespace parameters {
 			"\n\n");
 
 		struct vectorInfo {
-			std::string title;
-			std::vector<ParamPtr> params;
+			ParamsVector *vec;
+			// the candidates for the 'used' list: only the dirty set for a section report, when that one is complete.
+			const std::vector<ParamPtr> &params;
+			// the collected dirty set grows when touched_list() is invoked again for the same vector; we only report on the ones we've counted.
+			size_t count;
 		};
 		std::vector<vectorInfo> info_set;
+		info_set.reserve(set.get().size());
 
-		// first collect all parameters and sort them:
-		for (const ParamsVector *vec : set.get()) {
+		// first collect all parameters, sorted by name, per vectorset / section:
+		for (ParamsVector *vec : set.get()) {
 			LIBASSERT_DEBUG_ASSERT(vec != nullptr);
 
-			vectorInfo &info = info_set.emplace_back(vec->title(), vec->as_list());
-
-			// sort the parameters by name, per vectorset / section:
-			std::sort(info.params.begin(), info.params.end(), [](const ParamPtr& a, const ParamPtr& b)
-			{
-				int rv = sign_of_diff(a->is_init(), b->is_init());
-				if (rv == 0)
-				{
-					rv = sign_of_diff(b->is_debug(), a->is_debug());
-					if (rv == 0)
-					{
-						rv = strcmp(b->name_str(), a->name_str());
-#if !defined(NDEBUG)
-						if (rv == 0)
-						{
-							LIBASSERT_PANIC(fmt::format("Apparently you have double-defined a {} Variable: '{}'! Fix that in the source code!\n", ParamUtils::GetApplicationName(), a->name_str()).c_str());
-						}
-#endif
-					}
-				}
-				return (rv >= 0);
-			});
+			if (!is_section_subreport) {
+				// produce the final lump-sum overview report: fold the current counts into the run totals, without recording
+				// this as yet another section in the section history.
+				vec->reset_access_counts(false);
+			}
+			const std::vector<ParamPtr> &params = (is_section_subreport && vec->tracks_all_accesses() ? vec->touched_list() : vec->sorted_list());
+			info_set.push_back({vec, params, params.size()});
 		}
 
-		static const char* categories[] = {"(Global)", "(Local)"};
-		static const char* sections[] = {"", "(Init)", "(Debug)", "(Init+Dbg)"};
-		static const char* write_access[] = {".", "w", "W"};
-		static const char* read_access[] = {".", "r", "R"};
-
 		int total_count = 0;
 
 		// then print the results collected thus far...
 		for (vectorInfo &info : info_set) {
-			std::string listmsg;
+			// count first, so we know whether this vector needs a section header; then stream the report lines.
 			int count = 0;
+			for (size_t i = 0; i < info.count; i++) {
+				auto stats = info.params[i]->access_counts();
+				if ((is_section_subreport ? stats.reading : stats.prev_sum_reading) > 0)
+					count++;
+			}
 
-			if (!is_section_subreport) {
-				// produce the final lump-sum overview report
+			if (count > 0) {
+				total_count += count;
 
-				for (ParamPtr p : info.params) {
-					p->reset_access_counts();
-				}
+				dst.WriteHeaderLine(info.vec->title(), section_level + 1);
 
-				for (ParamPtr p : info.params) {
+				for (size_t i = 0; i < info.count; i++) {
+					ParamPtr p = info.params[i];
 					auto stats = p->access_counts();
-					if (stats.prev_sum_reading > 0)
-					{
-						count++;
-						int section = ((int)p->is_init()) | (2 * (int)p->is_debug());
-						std::string write_msg = fmt::format("{}{:4}", write_access[acc(stats.prev_sum_writing)], clip(stats.prev_sum_writing));
-						if (acc(stats.prev_sum_writing) == 0)
-							write_msg = ".    ";
-						std::string read_msg = fmt::format("{}{:4}", read_access[acc(stats.prev_sum_reading)], clip(stats.prev_sum_reading));
-						if (acc(stats.prev_sum_reading) == 0)
-							read_msg = ".    ";
-						std::string msg = fmt::format("* {:.<60} {:10} {}{} {:10} = {}\n", p->name_str(), sections[section], write_msg, read_msg, type_as_str(p->type()), p->formatted_value_str());
-						listmsg += msg;
+					if (!is_section_subreport) {
+						if (stats.prev_sum_reading > 0)
+							write_usage_report_line(dst, *p, stats.prev_sum_writing, stats.prev_sum_reading);
+					} else {
+						// produce the section-local report of used parameters
+						if (stats.reading > 0)
+							write_usage_report_line(dst, *p, stats.writing, stats.reading);
 					}
 				}
-			} else {
-				// produce the section-local report of used parameters
-
-				for (ParamPtr p : info.params) {
+			}
+		}
+		if (total_count == 0) {
+			dst.WriteInfoParagraph("(No parameters were used in this run-time section.)\n");
+		}
+		// listing the unused parameters requires a scan of all parameters, which is the bulk of the cost of a section report
+		// when only a few parameters have been touched: callers can skip that part via `report_unused_params`.
+		if (report_all_variables) {
+			int total_unused_count = 0;
+			for (vectorInfo &info : info_set) {
+				const std::vector<ParamPtr> &params = info.vec->sorted_list();
+				int count = 0;
+				for (ParamPtr p : params) {
 					auto stats = p->access_counts();
-					if (stats.reading > 0)
-					{
+					if ((is_section_subreport ? stats.reading : stats.prev_sum_reading) <= 0)
 						count++;
-						int section = ((int)p->is_init()) | (2 * (int)p->is_debug());
-						std::string write_msg = fmt::format("{}{:4}", write_access[acc(stats.writing)], clip(stats.writing));
-						if (acc(stats.writing) == 0)
-							write_msg = ".    ";
-						std::string read_msg = fmt::format("{}{:4}", read_access[acc(stats.reading)], clip(stats.reading));
-						if (acc(stats.reading) == 0)
-							read_msg = ".    ";
-						std::string msg = fmt::format("* {:.<60} {:10} {}{} {:10} = {}\n", p->name_str(), sections[section], write_msg, read_msg, type_as_str(p->type()), p->formatted_value_str());
-						listmsg += msg;
+				}
+
+				if (count > 0) {
+					if (total_unused_count == 0) {
+						dst.WriteHeaderLine("Unused Parameters:", section_level + 1);
+					}
+					total_unused_count += count;
+
+					dst.WriteHeaderLine(info.vec->title(), section_level + 2);
+
+					for (ParamPtr p : params) {
+						auto stats = p->access_counts();
+						if (!is_section_subreport) {
+							if (stats.prev_sum_reading <= 0)
+								write_usage_report_line(dst, *p, stats.prev_sum_writing, 0);
+						} else {
+							if (stats.reading <= 0)
+								write_usage_report_line(dst, *p, stats.writing, 0);
+						}
 					}
 				}
 			}
+		}
+		// reset the access counts for the next section; only a section report actually closes a section.
+		for (vectorInfo &info : info_set) {
+			info.vec->reset_access_counts(is_section_subreport);
+		}
+	}
 
-			if (count > 0) {
-				total_count += count;
+	static volatile size_t read_cost_sink;
+
+	// The cost of a single value() call for the given parameter type, in nanoseconds, measured on a private parameter.
+	static double measure_read_cost_ns(ParamType type) {
+		ParamsVector vec("read cost calibration");
+		IntParam ip(int32_t(1), "calibration_int", "", vec);
+		BoolParam bp(true, "calibration_bool", "", vec);
+		DoubleParam dp(1.0, "calibration_double", "", vec);
+		StringParam sp(std::string("1"), "calibration_string", "", vec);
+
+		// reading through volatile pointers keeps the compiler from hoisting the value() calls out of the loop.
+		IntParam *volatile ipp = &ip;
+		BoolParam *volatile bpp = &bp;
+		DoubleParam *volatile dpp = &dp;
+		StringParam *volatile spp = &sp;
+
+		const int rounds = 1 << 18;
+		size_t sink = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; i++) {
+			switch (type) {
+			case INT_PARAM:
+				sink += size_t(ipp->value());
+				break;
+
+			case BOOL_PARAM:
+				sink += size_t(bpp->value());
+				break;
+
+			case DOUBLE_PARAM:
+				sink += size_t(dpp->value() > 0.5);
+				break;
+
+			default:
+				// all other types return a reference, just like the string parameters do.
+				sink += spp->value().size();
+				break;
+			}
+		}
+		auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		read_cost_sink = sink;
+		return duration / rounds;
+	}
 
-				dst.WriteHeaderLine(info.title, section_level + 1);
+	static double read_cost_ns(ParamType type) {
+		static const double costs[4] = {
+			measure_read_cost_ns(INT_PARAM),
+			measure_read_cost_ns(BOOL_PARAM),
+			measure_read_cost_ns(DOUBLE_PARAM),
+			measure_read_cost_ns(STRING_PARAM),
+		};
+		switch (type) {
+		case INT_PARAM:
+			return costs[0];
+		case BOOL_PARAM:
+			return costs[1];
+		case DOUBLE_PARAM:
+			return costs[2];
+		default:
+			return costs[3];
+		}
+	}
+
+	void ParamUtils::ReportHotParams(ReportWriter &dst, const ParamsVectorSet &set, size_t top_k, uint32_t hot_read_threshold, const char *section_title) {
+		if (!section_title || !*section_title)
+			section_title = ParamUtils::GetApplicationName().c_str();
 
-				dst.WriteOther(ReportWriter::PARAMREPORT_ITEM_LIST, listmsg);
+		struct hotInfo {
+			ParamPtr param;
+			uint64_t reads;                 // in the current section plus the recorded history
+			uint64_t section_reads;         // in the current section
+			uint32_t sections_read;
+			uint32_t hot_sections;          // sections with at least `hot_read_threshold` reads
+			uint32_t hot_changed_sections;  // hot sections in which the parameter value changed as well
+		};
+		std::vector<hotInfo> hot;
+		std::unordered_map<ParamPtr, size_t> index;
+
+		auto account = [&](ParamPtr p, uint32_t reading, uint32_t changing, bool current) {
+			if (reading == 0)
+				return;
+			auto [l, inserted] = index.try_emplace(p, hot.size());
+			if (inserted)
+				hot.push_back({p, 0, 0, 0, 0, 0});
+			hotInfo &h = hot[l->second];
+			h.reads += reading;
+			if (current)
+				h.section_reads = reading;
+			h.sections_read++;
+			if (reading >= hot_read_threshold) {
+				h.hot_sections++;
+				if (changing > 0)
+					h.hot_changed_sections++;
+			}
+		};
+
+		for (ParamsVector *vec : set.get()) {
+			LIBASSERT_DEBUG_ASSERT(vec != nullptr);
+
+			for (const ParamsSectionRecord &record : vec->section_history()) {
+				for (const ParamSectionCounts &c : record.counts) {
+					account(c.param, c.reading, c.changing, false);
+				}
+			}
+			// the current section: the dirty set suffices when it is complete.
+			const std::vector<ParamPtr> &params = (vec->tracks_all_accesses() ? vec->touched_list() : vec->sorted_list());
+			for (ParamPtr p : params) {
+				const auto &counts = p->access_counts();
+				account(p, counts.reading, counts.changing, true);
 			}
 		}
-		if (total_count == 0) {
-			dst.WriteInfoParagraph("(No parameters were used in this run-time section.)\n");
+
+		size_t n = std::min(top_k, hot.size());
+		std::partial_sort(hot.begin(), hot.begin() + n, hot.end(), [](const hotInfo &a, const hotInfo &b) {
+			if (a.reads != b.reads)
+				return a.reads > b.reads;
+			return ParamsVector::report_order_less(a.param, b.param);
+		});
+
+		dst.WriteHeaderLine(fmt::format("{}: Hot Parameters: the top {} most frequently read params", section_title, n), 1);
+
+		dst.WriteOther(ReportWriter::PARAMREPORT_TABLE_LEGENDA, fmt::format("\n\n"
+			"(columns: the number of reads in the current section and the recorded section history, the reads in the current section, "
+			"the estimated time spent in the value() calls, the number of sections in which the param was read resp. read at least {} times, "
+			"and `H` when the param never changed in any of those hot sections: a candidate for hoisting the reads into a local variable)\n"
+			"\n\n", hot_read_threshold));
+
+		if (n == 0) {
+			dst.WriteInfoParagraph("(No parameters have been read.)\n");
+			return;
 		}
-		int total_unused_count = 0;
-		for (vectorInfo &info : info_set) {
-			std::string listmsg;
-			int count = 0;
 
-			if (!is_section_subreport) {
-				// produce the final lump-sum overview report
+		for (size_t i = 0; i < n; i++) {
+			const hotInfo &h = hot[i];
+			const Param &p = *h.param;
+			double est_ms = h.reads * read_cost_ns(p.type()) / 1.0e6;
+			bool hoist = (h.hot_sections > 0 && h.hot_changed_sections == 0);
+
+			if (dst.IsJSONOutput()) {
+				size_t start = dst.BeginJSONRecord();
+				dst.Append("{\"record\":\"hot_param\",\"rank\":");
+				dst.Format("{},\"name\":", i + 1);
+				dst.AppendJSONString(p.name_str());
+				dst.Format(",\"type\":\"{}\",\"reads\":{},\"section_reads\":{},\"est_read_time_ms\":{:.3f},\"sections_read\":{},\"hot_sections\":{},\"hot_changed_sections\":{},\"hoist_candidate\":{}}}",
+					type_as_str(p.type()), h.reads, h.section_reads, est_ms, h.sections_read, h.hot_sections, h.hot_changed_sections, hoist);
+				dst.EndJSONRecord(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
+				continue;
+			}
 
-				for (ParamPtr p : info.params) {
-					auto stats = p->access_counts();
-					if (stats.prev_sum_reading <= 0)
-					{
-						count++;
-						int section = ((int)p->is_init()) | (2 * (int)p->is_debug());
-						std::string write_msg = fmt::format("{}{:4}", write_access[acc(stats.prev_sum_writing)], clip(stats.prev_sum_writing));
-						if (acc(stats.prev_sum_writing) == 0)
-							write_msg = ".    ";
-						const char *read_msg = ".    ";
-						std::string msg = fmt::format("* {:.<60} {:10} {}{} {:10} = {}\n", p->name_str(), sections[section], write_msg, read_msg, type_as_str(p->type()), p->formatted_value_str());
-						listmsg += msg;
-					}
-				}
-			} else {
-				// produce the section-local report of used parameters
+			size_t start = dst.BeginLine();
+			dst.Format("{:4}. {:.<60} {:10} {:12} {:10} {:10.3f}ms {:5} {:5} {}\n", i + 1, p.name_str(), type_as_str(p.type()), h.reads, h.section_reads, est_ms, h.sections_read, h.hot_sections, (hoist ? "H" : "."));
+			dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
+		}
+	}
 
-				for (ParamPtr p : info.params) {
-					auto stats = p->access_counts();
-					if (stats.reading <= 0)
-					{
-						count++;
-						int section = ((int)p->is_init()) | (2 * (int)p->is_debug());
-						std::string write_msg = fmt::format("{}{:4}", write_access[acc(stats.writing)], clip(stats.writing));
-						if (acc(stats.writing) == 0)
-							write_msg = ".    ";
-						const char *read_msg = ".    ";
-						std::string msg = fmt::format("* {:.<60} {:10} {}{} {:10} = {}\n", p->name_str(), sections[section], write_msg, read_msg, type_as_str(p->type()), p->formatted_value_str());
-						listmsg += msg;
-					}
+	void ParamUtils::ReportHandlerTimings(ReportWriter &dst, const ParamsVectorSet &set, size_t top_k, const char *section_title) {
+		if (!section_title || !*section_title)
+			section_title = ParamUtils::GetApplicationName().c_str();
+
+		struct handlerInfo {
+			ParamPtr param;
+			Param::HandlerKind kind;
+			const Param::handler_timing_t *timing;
+		};
+		std::vector<handlerInfo> handlers;
+
+		for (ParamsVector *vec : set.get()) {
+			LIBASSERT_DEBUG_ASSERT(vec != nullptr);
+
+			for (ParamPtr p : vec->sorted_list()) {
+				const Param::handler_timings_t *timings = p->handler_timings();
+				if (!timings)
+					continue;
+				for (int kind = 0; kind < Param::HANDLER_KIND_COUNT; kind++) {
+					if (timings->handler[kind].calls > 0)
+						handlers.push_back({p, Param::HandlerKind(kind), &timings->handler[kind]});
 				}
 			}
+		}
 
-			if (count > 0) {
-				if (total_unused_count == 0) {
-					dst.WriteHeaderLine("Unused Parameters:", section_level + 1);
-				}
-				total_unused_count += count;
+		size_t n = std::min(top_k, handlers.size());
+		std::partial_sort(handlers.begin(), handlers.begin() + n, handlers.end(), [](const handlerInfo &a, const handlerInfo &b) {
+			return a.timing->total_ns > b.timing->total_ns;
+		});
 
-				dst.WriteHeaderLine(info.title, section_level + 2);
+		dst.WriteHeaderLine(fmt::format("{}: Handler Timings: the top {} most expensive parameter event handlers", section_title, n), 1);
 
-				dst.WriteOther(ReportWriter::PARAMREPORT_ITEM_LIST, listmsg);
-			}
+		dst.WriteOther(ReportWriter::PARAMREPORT_TABLE_LEGENDA, "\n\n"
+			"(columns: the handler kind, the number of calls, the cumulative latency, the average and the maximum latency per call)\n"
+			"\n\n");
+
+		if (n == 0) {
+			dst.WriteInfoParagraph("(No handler invocations have been timed.)\n");
+			return;
 		}
-		// reset the access counts for the next section:
-		for (vectorInfo &info : info_set) {
-			for (ParamPtr p : info.params) {
-				p->reset_access_counts();
+
+		for (size_t i = 0; i < n; i++) {
+			const handlerInfo &h = handlers[i];
+			const Param &p = *h.param;
+			const Param::handler_timing_t &t = *h.timing;
+			double avg_us = t.total_ns / 1.0e3 / t.calls;
+
+			if (dst.IsJSONOutput()) {
+				size_t start = dst.BeginJSONRecord();
+				dst.Append("{\"record\":\"handler_timing\",\"rank\":");
+				dst.Format("{},\"name\":", i + 1);
+				dst.AppendJSONString(p.name_str());
+				dst.Format(",\"handler\":\"{}\",\"calls\":{},\"total_ms\":{:.3f},\"avg_us\":{:.3f},\"max_us\":{:.3f}}}",
+					Param::handler_kind_str(h.kind), t.calls, t.total_ns / 1.0e6, avg_us, t.max_ns / 1.0e3);
+				dst.EndJSONRecord(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
+				continue;
 			}
+
+			size_t start = dst.BeginLine();
+			dst.Format("{:4}. {:.<60} {:8} {:10} {:12.3f}ms {:10.3f}us {:10.3f}us\n", i + 1, p.name_str(), Param::handler_kind_str(h.kind), t.calls, t.total_ns / 1.0e6, avg_us, t.max_ns / 1.0e3);
+			dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
+		}
+	}
+
+#if PARAMETERS_TRACK_CALL_SITES
+	static void write_call_site_report_line(ReportWriter &dst, const Param &p, const Param::call_site_t &site, uint64_t est_reads) {
+		if (dst.IsJSONOutput()) {
+			size_t start = dst.BeginJSONRecord();
+			dst.Append("{\"record\":\"call_site\",\"name\":");
+			dst.AppendJSONString(p.name_str());
+			dst.Append(",\"file\":");
+			dst.AppendJSONString(site.file);
+			dst.Format(",\"line\":{},\"function\":", site.line);
+			dst.AppendJSONString(site.function);
+			dst.Format(",\"writes\":{},\"sampled_reads\":{},\"estimated_reads\":{}}}", site.writes, site.sampled_reads, est_reads);
+			dst.EndJSONRecord(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
+			return;
 		}
+
+		size_t start = dst.BeginLine();
+		dst.Format("* {:.<60} {:8} {:10}  {}:{}  ({})\n", p.name_str(), site.writes, est_reads, site.file, site.line, site.function);
+		dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start, &p);
 	}
 
+	void ParamUtils::ReportParamCallSites(ReportWriter &dst, const ParamsVectorSet &set, size_t max_sites_per_param, const char *section_title) {
+		if (!section_title || !*section_title)
+			section_title = ParamUtils::GetApplicationName().c_str();
+
+		const uint64_t sampling = Param::call_site_read_sampling();
+
+		dst.WriteHeaderLine(fmt::format("{}: Parameter Call Sites: which code reads and writes the params?", section_title), 1);
+
+		dst.WriteOther(ReportWriter::PARAMREPORT_TABLE_LEGENDA, fmt::format("\n\n"
+			"(columns: the number of writes, followed by the estimated number of reads, as only one in every {} reads is sampled, and the call site)\n"
+			"\n\n", sampling));
+
+		std::vector<const Param::call_site_t *> sites;
+		size_t total_count = 0;
+		for (ParamsVector *vec : set.get()) {
+			LIBASSERT_DEBUG_ASSERT(vec != nullptr);
+
+			bool has_header = false;
+			for (ParamPtr p : vec->sorted_list()) {
+				const auto &call_sites = p->call_sites();
+				if (call_sites.empty())
+					continue;
+				if (!has_header) {
+					dst.WriteHeaderLine(vec->title(), 2);
+					has_header = true;
+				}
+
+				sites.clear();
+				for (const auto &site : call_sites) {
+					sites.push_back(&site);
+				}
+				size_t n = std::min(sites.size(), max_sites_per_param);
+				std::partial_sort(sites.begin(), sites.begin() + n, sites.end(), [sampling](const Param::call_site_t *a, const Param::call_site_t *b) {
+					return a->writes + a->sampled_reads * sampling > b->writes + b->sampled_reads * sampling;
+				});
+				for (size_t i = 0; i < n; i++) {
+					write_call_site_report_line(dst, *p, *sites[i], sites[i]->sampled_reads * sampling);
+				}
+				total_count++;
+			}
+		}
+		if (total_count == 0) {
+			dst.WriteInfoParagraph("(No call sites have been recorded.)\n");
+		}
+	}
+#endif
 
 }	// namespace
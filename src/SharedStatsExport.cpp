@@ -0,0 +1,261 @@
+
+#include <parameters/parameters.h>
+
+#include "internal_helpers.hpp"
+#include "logchannel_helpers.hpp"
+#include "os_platform_helpers.hpp"
+
+#include <new>
+
+#if !defined(_WIN32)
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+
+namespace parameters {
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// SharedStatsExport
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	static const char sharedstats_magic[4] = {'P', 'S', 'H', 'M'};
+	static const uint16_t sharedstats_format_version = 1;
+
+	SharedStatsExport::SharedStatsExport(const char *name, const ParamsVectorSet &set, std::chrono::milliseconds interval)
+		: _name(name ? name : "")
+		, _header(nullptr)
+		, _slots(nullptr)
+		, _size(0)
+#if defined(_WIN32)
+		, _mapping_handle(nullptr)
+#endif
+		, _interval(interval)
+		, _stop(false)
+	{
+		create(set);
+		if (_header) {
+			Publish();
+			_publisher = std::thread([this]() {
+				run();
+			});
+		} else {
+			PARAM_ERROR("Cannot export the parameter usage statistics: {}\n", _errmsg);
+		}
+	}
+
+	SharedStatsExport::~SharedStatsExport() {
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			_stop = true;
+		}
+		_wakeup.notify_all();
+		if (_publisher.joinable())
+			_publisher.join();
+		destroy();
+	}
+
+	const std::string &SharedStatsExport::error_message() const {
+		return _errmsg;
+	}
+
+	const std::string &SharedStatsExport::name() const {
+		return _name;
+	}
+
+	void SharedStatsExport::create(const ParamsVectorSet &set) {
+		if (_name.empty()) {
+			_errmsg = "no shared memory segment name specified";
+			return;
+		}
+
+		_params = set.as_list();
+		std::string names;
+		for (ParamPtr p : _params) {
+			names += p->name_str();
+			names += '\0';
+		}
+
+		const size_t names_offset = sizeof(SharedStatsHeader) + _params.size() * sizeof(SharedStatsSlot);
+		const size_t size = names_offset + names.size();
+		if (size > UINT32_MAX) {
+			_errmsg = fmt::format("the shared memory segment for {} parameters would be too large ({} bytes)", _params.size(), size);
+			return;
+		}
+
+		void *m = nullptr;
+#if defined(_WIN32)
+		HANDLE mh = ::CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, DWORD(size), _name.c_str());
+		if (!mh) {
+			_errmsg = fmt::format("cannot create shared memory segment '{}' (error: {})", _name, ::GetLastError());
+			return;
+		}
+		_mapping_handle = mh;
+		m = ::MapViewOfFile(mh, FILE_MAP_WRITE, 0, 0, size);
+		if (!m) {
+			_errmsg = fmt::format("cannot map shared memory segment '{}' into memory (error: {})", _name, ::GetLastError());
+			::CloseHandle(mh);
+			_mapping_handle = nullptr;
+			return;
+		}
+#else
+		// a stale segment, left by a crashed predecessor, is replaced.
+		int fd = ::shm_open(_name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+		if (fd < 0) {
+			_errmsg = fmt::format("cannot create shared memory segment '{}': {}", _name, strerror(errno));
+			return;
+		}
+		if (::ftruncate(fd, off_t(size)) != 0) {
+			_errmsg = fmt::format("cannot size shared memory segment '{}' to {} bytes: {}", _name, size, strerror(errno));
+			::close(fd);
+			::shm_unlink(_name.c_str());
+			return;
+		}
+		m = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		// the mapping remains valid after the file descriptor has been closed.
+		::close(fd);
+		if (m == MAP_FAILED) {
+			_errmsg = fmt::format("cannot map shared memory segment '{}' into memory: {}", _name, strerror(errno));
+			::shm_unlink(_name.c_str());
+			return;
+		}
+#endif
+		_size = size;
+		memset(m, 0, size);
+
+		uint8_t *base = static_cast<uint8_t *>(m);
+		SharedStatsHeader *hdr = new (base) SharedStatsHeader;
+		memcpy(hdr->magic, sharedstats_magic, sizeof(sharedstats_magic));
+		hdr->version = sharedstats_format_version;
+		hdr->slot_size = uint16_t(sizeof(SharedStatsSlot));
+		hdr->slot_count = uint32_t(_params.size());
+		hdr->names_offset = uint32_t(names_offset);
+		hdr->names_size = uint32_t(names.size());
+#if defined(_WIN32)
+		hdr->pid = uint32_t(::GetCurrentProcessId());
+#else
+		hdr->pid = uint32_t(::getpid());
+#endif
+		hdr->sequence.store(0, std::memory_order_relaxed);
+		hdr->publish_time = 0;
+
+		_slots = reinterpret_cast<SharedStatsSlot *>(base + sizeof(SharedStatsHeader));
+		uint32_t name_offset = 0;
+		for (size_t i = 0; i < _params.size(); i++) {
+			SharedStatsSlot &slot = _slots[i];
+			slot.name_offset = name_offset;
+			slot.type = uint16_t(_params[i]->type());
+			name_offset += uint32_t(strlen(_params[i]->name_str()) + 1);
+		}
+		if (!names.empty())
+			memcpy(base + names_offset, names.data(), names.size());
+
+		_header = hdr;
+	}
+
+	void SharedStatsExport::destroy() {
+		if (!_header)
+			return;
+		_header->~SharedStatsHeader();
+#if defined(_WIN32)
+		::UnmapViewOfFile(_header);
+		if (_mapping_handle) {
+			::CloseHandle(static_cast<HANDLE>(_mapping_handle));
+			_mapping_handle = nullptr;
+		}
+#else
+		::munmap(_header, _size);
+		::shm_unlink(_name.c_str());
+#endif
+		_header = nullptr;
+		_slots = nullptr;
+		_size = 0;
+	}
+
+	void SharedStatsExport::Publish() {
+		if (!_header)
+			return;
+
+		std::lock_guard<std::mutex> guard(_lock);
+
+		// seqlock: an odd sequence number tells the readers we're in the middle of an update.
+		uint64_t seq = _header->sequence.load(std::memory_order_relaxed);
+		_header->sequence.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (size_t i = 0; i < _params.size(); i++) {
+			// We read the parameters without any synchronization with the threads using them: the counters and values may be
+			// slightly stale, but we never block or disturb those threads. We don't use the value() accessors, as those
+			// would count our reads.
+			const Param *p = _params[i];
+			SharedStatsSlot &slot = _slots[i];
+
+			uint8_t flags = 0;
+			if (p->is_init())
+				flags |= SHAREDSTATS_IS_INIT;
+			if (p->is_debug())
+				flags |= SHAREDSTATS_IS_DEBUG;
+			if (p->is_set_to_non_default_value())
+				flags |= SHAREDSTATS_IS_NON_DEFAULT;
+			if (p->has_faulted())
+				flags |= SHAREDSTATS_HAS_FAULTED;
+
+			switch (p->type()) {
+			case INT_PARAM:
+				slot.value.i = static_cast<const IntParam *>(p)->raw_value();
+				flags |= SHAREDSTATS_HAS_INT_VALUE;
+				break;
+
+			case BOOL_PARAM:
+				slot.value.i = static_cast<const BoolParam *>(p)->raw_value();
+				flags |= SHAREDSTATS_HAS_INT_VALUE;
+				break;
+
+			case DOUBLE_PARAM:
+				slot.value.d = static_cast<const DoubleParam *>(p)->raw_value();
+				flags |= SHAREDSTATS_HAS_DOUBLE_VALUE;
+				break;
+
+			default:
+				slot.value.i = 0;
+				break;
+			}
+
+			const auto &counts = p->access_counts();
+			slot.set_mode = uint8_t(p->set_mode());
+			slot.flags = flags;
+			slot.reading = counts.reading;
+			slot.writing = counts.writing;
+			slot.changing = counts.changing;
+			slot.faulting = counts.faulting;
+			slot.total_reading = counts.prev_sum_reading + counts.reading;
+			slot.total_writing = counts.prev_sum_writing + counts.writing;
+			slot.total_changing = counts.prev_sum_changing + counts.changing;
+			slot.total_faulting = counts.prev_sum_faulting + counts.faulting;
+			slot.version = p->version();
+		}
+
+		_header->publish_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+		std::atomic_thread_fence(std::memory_order_release);
+		_header->sequence.store(seq + 2, std::memory_order_release);
+	}
+
+	void SharedStatsExport::run() {
+		std::unique_lock<std::mutex> guard(_lock);
+		while (!_stop) {
+			if (_wakeup.wait_for(guard, _interval, [this]() {
+				return _stop;
+			}))
+				break;
+			guard.unlock();
+			Publish();
+			guard.lock();
+		}
+	}
+
+}	// namespace
@@ -5,184 +5,838 @@
 #include "logchannel_helpers.hpp"
 #include "os_platform_helpers.hpp"
 
+#include <unordered_set>
+#include <errno.h>
+
 
 namespace parameters {
 
-	Snapshot::Snapshot(const char *snap_name): name(snap_name) {
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// SnapshotValues
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void SnapshotValues::Record(Param *p) {
+		// fetching the value for a snapshot is not a *use* of the parameter: we use the non-counting raw accessors, which don't
+		// touch the parameter's access administration either.
+		switch (p->type()) {
+		case INT_PARAM: {
+			IntParam *ip = static_cast<IntParam *>(p);
+			int_params.push_back(p);
+			int_values.push_back(ip->raw_value());
+		} break;
+
+		case BOOL_PARAM: {
+			BoolParam *ip = static_cast<BoolParam *>(p);
+			bool_params.push_back(p);
+			bool_values.push_back(ip->raw_value());
+		} break;
+
+		case DOUBLE_PARAM: {
+			DoubleParam *ip = static_cast<DoubleParam *>(p);
+			double_params.push_back(p);
+			double_values.push_back(ip->raw_value());
+		} break;
+
+		case STRING_PARAM: {
+			StringParam *ip = static_cast<StringParam *>(p);
+			string_params.push_back(p);
+			string_arena += ip->raw_value();
+			DEBUG_ASSERT(string_arena.size() <= UINT32_MAX);
+			string_ends.push_back(uint32_t(string_arena.size()));
+		} break;
+
+		default: {
+			other_params.push_back(p);
+			other_arena += p->raw_value_str();
+			DEBUG_ASSERT(other_arena.size() <= UINT32_MAX);
+			other_ends.push_back(uint32_t(other_arena.size()));
+		} break;
+		}
+	}
+
+	std::string SnapshotValues::arena_string(const std::string &arena, const std::vector<uint32_t> &ends, size_t i) {
+		uint32_t start = (i == 0 ? 0 : ends[i - 1]);
+		return std::string(arena.data() + start, ends[i] - start);
+	}
+
+	void SnapshotValues::RestoreAll() const {
+		// only reset the value (and count the write action!)
+		// 
+		// DO NOT reset the statistics!
+		for (size_t i = int_params.size(); i > 0; i--) {
+			static_cast<IntParam *>(int_params[i - 1])->set_value(int_values[i - 1], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = bool_params.size(); i > 0; i--) {
+			static_cast<BoolParam *>(bool_params[i - 1])->set_value(bool_values[i - 1] != 0, PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = double_params.size(); i > 0; i--) {
+			static_cast<DoubleParam *>(double_params[i - 1])->set_value(double_values[i - 1], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = string_params.size(); i > 0; i--) {
+			static_cast<StringParam *>(string_params[i - 1])->set_value(arena_string(string_arena, string_ends, i - 1), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = other_params.size(); i > 0; i--) {
+			other_params[i - 1]->set_value(arena_string(other_arena, other_ends, i - 1), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+	}
+
+	void SnapshotValues::RestoreChanged(uint64_t version_stamp, std::unordered_set<Param *> &restored) const {
+		// only restore the parameters which have been changed since `version_stamp` and haven't been restored already.
+		auto must_restore = [version_stamp, &restored](Param *p) -> bool {
+			return p->version() > version_stamp && restored.insert(p).second;
+		};
+
+		for (size_t i = 0, n = int_params.size(); i < n; i++) {
+			if (must_restore(int_params[i]))
+				static_cast<IntParam *>(int_params[i])->set_value(int_values[i], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = 0, n = bool_params.size(); i < n; i++) {
+			if (must_restore(bool_params[i]))
+				static_cast<BoolParam *>(bool_params[i])->set_value(bool_values[i] != 0, PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = 0, n = double_params.size(); i < n; i++) {
+			if (must_restore(double_params[i]))
+				static_cast<DoubleParam *>(double_params[i])->set_value(double_values[i], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = 0, n = string_params.size(); i < n; i++) {
+			if (must_restore(string_params[i]))
+				static_cast<StringParam *>(string_params[i])->set_value(arena_string(string_arena, string_ends, i), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (size_t i = 0, n = other_params.size(); i < n; i++) {
+			if (must_restore(other_params[i]))
+				other_params[i]->set_value(arena_string(other_arena, other_ends, i), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+	}
+
+	void SnapshotValues::AppendChanged(const SnapshotValues &src, uint64_t version_stamp, std::unordered_set<Param *> &seen) {
+		auto must_copy = [version_stamp, &seen](Param *p) -> bool {
+			return p->version() > version_stamp && seen.insert(p).second;
+		};
+		// copy a string straight from arena to arena:
+		auto copy_string = [](std::string &dst_arena, std::vector<uint32_t> &dst_ends, const std::string &src_arena, const std::vector<uint32_t> &src_ends, size_t i) {
+			uint32_t start = (i == 0 ? 0 : src_ends[i - 1]);
+			dst_arena.append(src_arena, start, src_ends[i] - start);
+			DEBUG_ASSERT(dst_arena.size() <= UINT32_MAX);
+			dst_ends.push_back(uint32_t(dst_arena.size()));
+		};
+
+		for (size_t i = 0, n = src.int_params.size(); i < n; i++) {
+			if (must_copy(src.int_params[i])) {
+				int_params.push_back(src.int_params[i]);
+				int_values.push_back(src.int_values[i]);
+			}
+		}
+		for (size_t i = 0, n = src.bool_params.size(); i < n; i++) {
+			if (must_copy(src.bool_params[i])) {
+				bool_params.push_back(src.bool_params[i]);
+				bool_values.push_back(src.bool_values[i]);
+			}
+		}
+		for (size_t i = 0, n = src.double_params.size(); i < n; i++) {
+			if (must_copy(src.double_params[i])) {
+				double_params.push_back(src.double_params[i]);
+				double_values.push_back(src.double_values[i]);
+			}
+		}
+		for (size_t i = 0, n = src.string_params.size(); i < n; i++) {
+			if (must_copy(src.string_params[i])) {
+				string_params.push_back(src.string_params[i]);
+				copy_string(string_arena, string_ends, src.string_arena, src.string_ends, i);
+			}
+		}
+		for (size_t i = 0, n = src.other_params.size(); i < n; i++) {
+			if (must_copy(src.other_params[i])) {
+				other_params.push_back(src.other_params[i]);
+				copy_string(other_arena, other_ends, src.other_arena, src.other_ends, i);
+			}
+		}
+	}
+
+	void SnapshotValues::ExportValues(std::unordered_map<Param *, SnapshotValue> &dst) const {
+		for (size_t i = 0, n = int_params.size(); i < n; i++) {
+			dst.try_emplace(int_params[i], int_values[i]);
+		}
+		for (size_t i = 0, n = bool_params.size(); i < n; i++) {
+			dst.try_emplace(bool_params[i], bool_values[i] != 0);
+		}
+		for (size_t i = 0, n = double_params.size(); i < n; i++) {
+			dst.try_emplace(double_params[i], double_values[i]);
+		}
+		for (size_t i = 0, n = string_params.size(); i < n; i++) {
+			if (!dst.contains(string_params[i]))
+				dst.emplace(string_params[i], arena_string(string_arena, string_ends, i));
+		}
+		for (size_t i = 0, n = other_params.size(); i < n; i++) {
+			if (!dst.contains(other_params[i]))
+				dst.emplace(other_params[i], arena_string(other_arena, other_ends, i));
+		}
+	}
+
+	SnapshotValue SnapshotValues::CurrentValue(Param *p) {
+		// just like Record(), this is not a *use* of the parameter; it only reads the parameter, so ParamsEpoch::Capture() et al
+		// can safely invoke it while other threads are using the parameter.
+		SnapshotValue rv;
+		switch (p->type()) {
+		case INT_PARAM:
+			rv = static_cast<IntParam *>(p)->raw_value();
+			break;
+
+		case BOOL_PARAM:
+			rv = static_cast<BoolParam *>(p)->raw_value();
+			break;
+
+		case DOUBLE_PARAM:
+			rv = static_cast<DoubleParam *>(p)->raw_value();
+			break;
+
+		case STRING_PARAM:
+			rv = static_cast<StringParam *>(p)->raw_value();
+			break;
+
+		default:
+			rv = p->raw_value_str();
+			break;
+		}
+		return rv;
 	}
 
-	SnapshotPtr Snapshot::TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals) {
-		SnapshotPtr snap(new Snapshot());
+	void SnapshotValues::MergeMissing(const SnapshotValues &src) {
+		std::unordered_set<Param *> seen;
+		seen.reserve(size() + src.size());
+		for (const std::vector<Param *> *params : {&int_params, &bool_params, &double_params, &string_params, &other_params}) {
+			seen.insert(params->begin(), params->end());
+		}
+		AppendChanged(src, 0, seen);
+	}
 
-		size_t items_count = 0;
-		if (locals) {
-			for (ParamsVector *vec : locals->collection_) {
-				items_count += vec->params_.size();
+	static const char snapshot_file_magic[4] = {'P', 'S', 'N', 'P'};
+	static const uint16_t snapshot_file_format_version = 1;
+
+	template <class T>
+	static inline void append_le_array(std::string &image, const std::vector<T> &src) {
+		if constexpr (std::endian::native == std::endian::little) {
+			image.append(reinterpret_cast<const char *>(src.data()), src.size() * sizeof(T));
+		} else {
+			for (T v : src) {
+				v = from_little_endian(v);
+				image.append(reinterpret_cast<const char *>(&v), sizeof(T));
 			}
 		}
-		if (globals) {
-			for (ParamsVector *vec : globals->collection_) {
-				items_count += vec->params_.size();
+	}
+
+	template <class T>
+	static inline void fetch_le_array(std::vector<T> &dst, const uint8_t *&pos, size_t count) {
+		dst.resize(count);
+		if (count > 0)
+			memcpy(dst.data(), pos, count * sizeof(T));
+		if constexpr (std::endian::native != std::endian::little) {
+			for (T &v : dst) {
+				v = from_little_endian(v);
 			}
 		}
-		snap->data.reserve(items_count);
-		snap->data.resize(items_count);
+		pos += count * sizeof(T);
+	}
+
+	// the end offsets must be ascending and cover the entire arena.
+	static bool valid_arena_ends(const std::vector<uint32_t> &ends, uint32_t arena_size) {
+		uint32_t start = 0;
+		for (uint32_t end : ends) {
+			if (end < start)
+				return false;
+			start = end;
+		}
+		return start == arena_size;
+	}
+
+	bool SnapshotValues::WriteFile(const char *path, uint64_t schema_fingerprint) const {
+		std::string names;
+		for (const std::vector<Param *> *params : {&int_params, &bool_params, &double_params, &string_params, &other_params}) {
+			for (Param *p : *params) {
+				append_normalized_param_name(names, p->name_str());
+				names += '\0';
+			}
+		}
+		std::vector<uint16_t> other_types;
+		other_types.reserve(other_params.size());
+		for (Param *p : other_params) {
+			other_types.push_back(uint16_t(p->type()));
+		}
+		DEBUG_ASSERT(names.size() <= UINT32_MAX);
+
+		SnapshotFileHeader hdr;
+		memcpy(hdr.magic, snapshot_file_magic, sizeof(snapshot_file_magic));
+		hdr.version = from_little_endian(snapshot_file_format_version);
+		hdr.reserved = 0;
+		hdr.schema_fingerprint = from_little_endian(schema_fingerprint);
+		hdr.int_count = from_little_endian(uint32_t(int_params.size()));
+		hdr.bool_count = from_little_endian(uint32_t(bool_params.size()));
+		hdr.double_count = from_little_endian(uint32_t(double_params.size()));
+		hdr.string_count = from_little_endian(uint32_t(string_params.size()));
+		hdr.other_count = from_little_endian(uint32_t(other_params.size()));
+		hdr.names_size = from_little_endian(uint32_t(names.size()));
+		hdr.string_arena_size = from_little_endian(uint32_t(string_arena.size()));
+		hdr.other_arena_size = from_little_endian(uint32_t(other_arena.size()));
+
+		// assemble the file image in memory, so we can write it in one go:
+		std::string image;
+		image.reserve(sizeof(hdr) + int_values.size() * sizeof(int32_t) + double_values.size() * sizeof(double)
+			+ (string_ends.size() + other_ends.size()) * sizeof(uint32_t) + other_types.size() * sizeof(uint16_t) + bool_values.size()
+			+ names.size() + string_arena.size() + other_arena.size());
+		image.append(reinterpret_cast<const char *>(&hdr), sizeof(hdr));
+		append_le_array(image, int_values);
+		append_le_array(image, double_values);
+		append_le_array(image, string_ends);
+		append_le_array(image, other_ends);
+		append_le_array(image, other_types);
+		append_le_array(image, bool_values);
+		image += names;
+		image += string_arena;
+		image += other_arena;
+
+		FILE *f = fopen(path, "wb");
+		if (!f) {
+			PARAM_ERROR("Cannot produce snapshot file: {}: {}\n", path, strerror(errno));
+			return false;
+		}
+		bool good = (fwrite(image.data(), 1, image.size(), f) == image.size());
+		if (fclose(f) != 0)
+			good = false;
+		if (!good) {
+			PARAM_ERROR("Failed to write snapshot file '{}': {}\n", path, strerror(errno));
+		}
+		return good;
+	}
+
+	size_t SnapshotValues::size() const noexcept {
+		return int_params.size() + bool_params.size() + double_params.size() + string_params.size() + other_params.size();
+	}
+
+	bool SnapshotValues::empty() const noexcept {
+		return size() == 0;
+	}
 
-		size_t item_idx = 0;
-		if (locals) {
-			for (ParamsVector *vec : locals->collection_) {
+	void SnapshotValues::clear() noexcept {
+		int_params.clear();
+		int_values.clear();
+		bool_params.clear();
+		bool_values.clear();
+		double_params.clear();
+		double_values.clear();
+		string_params.clear();
+		string_ends.clear();
+		string_arena.clear();
+		other_params.clear();
+		other_ends.clear();
+		other_arena.clear();
+	}
+
+	void SnapshotValues::shrink_to_fit() {
+		int_params.shrink_to_fit();
+		int_values.shrink_to_fit();
+		bool_params.shrink_to_fit();
+		bool_values.shrink_to_fit();
+		double_params.shrink_to_fit();
+		double_values.shrink_to_fit();
+		string_params.shrink_to_fit();
+		string_ends.shrink_to_fit();
+		string_arena.shrink_to_fit();
+		other_params.shrink_to_fit();
+		other_ends.shrink_to_fit();
+		other_arena.shrink_to_fit();
+	}
+
+	size_t SnapshotValues::memory_usage() const noexcept {
+		return (int_params.capacity() + bool_params.capacity() + double_params.capacity() + string_params.capacity() + other_params.capacity()) * sizeof(Param *)
+			+ int_values.capacity() * sizeof(int32_t) + bool_values.capacity() * sizeof(uint8_t) + double_values.capacity() * sizeof(double)
+			+ (string_ends.capacity() + other_ends.capacity()) * sizeof(uint32_t)
+			+ string_arena.capacity() + other_arena.capacity();
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// Snapshot
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Snapshot::Snapshot(const char *snap_name, const Snapshot *parent_snapshot)
+		: name(snap_name ? snap_name : ""),
+		parent(parent_snapshot),
+		version_stamp(Param::current_version()) {
+	}
+
+	SnapshotPtr Snapshot::TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals, const Snapshot *parent) {
+		SnapshotPtr snap(new Snapshot(name, parent));
+
+		// delta snapshots only record the parameters which have been changed since the parent snapshot was taken.
+		const uint64_t since = (parent ? parent->version_stamp : 0);
+
+		for (ParamsVectorSet *set : {locals, globals}) {
+			if (!set)
+				continue;
+			for (ParamsVector *vec : set->collection_) {
 				for (auto i : vec->params_) {
-					Snapshot::datums &datum = snap->data[item_idx++];
 					ParamPtr p = i.second;
-					switch (p->type()) {
-					case INT_PARAM: {
-						IntParam *ip = reinterpret_cast<IntParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case BOOL_PARAM: {
-						BoolParam *ip = reinterpret_cast<BoolParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case DOUBLE_PARAM: {
-						DoubleParam *ip = reinterpret_cast<DoubleParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case STRING_PARAM: {
-						StringParam *ip = reinterpret_cast<StringParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					default: {
-						datum.param_ref = p;
-						datum.stats = p->access_counts();
-						datum.value = p->value_str(VALSTR_PURPOSE_RAW_DEFAULT_DATA_4_INSPECT);
-					} break;
-					}
+					if (p->version() <= since)
+						continue;
+					snap->data.Record(p);
 				}
 			}
 		}
+		// snapshots are kept around for a while: don't waste memory on array growth slack.
+		snap->data.shrink_to_fit();
+
+		return snap;
+	}
+
+	void Snapshot::ResetToSnapshot(Snapshot &snapshot) {
+		// Walk the snapshot chain, most recent first: the first recorded value we encounter for any parameter is its value as it was at
+		// the time `snapshot` was taken.
+		// Parameters which haven't been changed since that time already carry that value, so we can skip those.
+		std::unordered_set<ParamPtr> restored;
+		for (const Snapshot *snap = &snapshot; snap != nullptr; snap = snap->parent) {
+			snap->data.RestoreChanged(snapshot.version_stamp, restored);
+		}
+	}
 
-		if (globals) {
-			for (ParamsVector *vec : globals->collection_) {
+	void Snapshot::RecordCurrentState(SnapshotValues &dst, const ParamsVectorSet *globals, const ParamsVectorSet *locals, std::unordered_set<ParamPtr> &seen) {
+		for (const ParamsVectorSet *set : {locals, globals}) {
+			if (!set)
+				continue;
+			for (ParamsVector *vec : set->collection_) {
 				for (auto i : vec->params_) {
-					Snapshot::datums &datum = snap->data[item_idx++];
 					ParamPtr p = i.second;
-					switch (p->type()) {
-					case INT_PARAM: {
-						IntParam *ip = reinterpret_cast<IntParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case BOOL_PARAM: {
-						BoolParam *ip = reinterpret_cast<BoolParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case DOUBLE_PARAM: {
-						DoubleParam *ip = reinterpret_cast<DoubleParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					case STRING_PARAM: {
-						StringParam *ip = reinterpret_cast<StringParam *>(p);
-						datum.param_ref = ip;
-						datum.stats = ip->access_counts();
-						datum.value = ip->value();
-					} break;
-
-					default: {
-						datum.param_ref = p;
-						datum.stats = p->access_counts();
-						datum.value = p->value_str(VALSTR_PURPOSE_RAW_DATA_4_INSPECT);
-					} break;
-					}
+					if (seen.insert(p).second)
+						dst.Record(p);
 				}
 			}
 		}
+	}
 
-		return snap;
+	size_t Snapshot::memory_usage() const noexcept {
+		return sizeof(Snapshot) + name.capacity() + data.memory_usage() + undo_log.memory_usage();
 	}
 
-	void Snapshot::ResetToSnapshot(Snapshot &snapshot) {
-		for (Snapshot::datums &datum : snapshot.data) {
-			ParamPtr p = datum.param_ref;
+	uint64_t Snapshot::SchemaFingerprint(const ParamsVectorSet *globals, const ParamsVectorSet *locals) {
+		// The hash tables don't guarantee any iteration order, so we combine the per-parameter hashes in an order-independent way.
+		uint64_t fingerprint = 0;
+		uint64_t count = 0;
+		std::string name;
+		for (const ParamsVectorSet *set : {locals, globals}) {
+			if (!set)
+				continue;
+			for (ParamsVector *vec : set->collection_) {
+				for (auto i : vec->params_) {
+					ParamPtr p = i.second;
+					name.clear();
+					append_normalized_param_name(name, p->name_str());
+					name += '\0';
+					name += std::to_string(unsigned(p->type()));
+
+					fingerprint += fnv1a_hash(name);
+					count++;
+				}
+			}
+		}
+		return fingerprint ^ (count * 0x9E3779B97F4A7C15ULL);
+	}
 
-			// only reset the value (and count the write action!)
-			// 
-			// DO NOT reset the statistics!
-			switch (p->type()) {
-			case INT_PARAM: {
-				IntParam *ip = reinterpret_cast<IntParam *>(p);
-				ip->set_value(std::get<int32_t>(datum.value), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
-			} break;
+	bool Snapshot::SaveToFile(const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals) {
+		SnapshotValues state;
+		std::unordered_set<ParamPtr> seen;
+		RecordCurrentState(state, globals, locals, seen);
+		return state.WriteFile(path, SchemaFingerprint(globals, locals));
+	}
 
-			case BOOL_PARAM: {
-				BoolParam *ip = reinterpret_cast<BoolParam *>(p);
-				ip->set_value(std::get<bool>(datum.value), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
-			} break;
+	// find the parameter in the given sets; it must have exactly the given type.
+	static ParamPtr find_snapshot_param(const char *name, ParamType type, const ParamsVectorSet *globals, const ParamsVectorSet *locals) {
+		for (const ParamsVectorSet *set : {locals, globals}) {
+			if (!set)
+				continue;
+			ParamPtr p = set->find(name, type);
+			if (p && p->type() == type)
+				return p;
+		}
+		return nullptr;
+	}
 
-			case DOUBLE_PARAM: {
-				DoubleParam *ip = reinterpret_cast<DoubleParam *>(p);
-				ip->set_value(std::get<double>(datum.value), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
-			} break;
+	bool Snapshot::RestoreFromFile(const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals, bool require_matching_schema) {
+		std::vector<uint8_t> image;
+		{
+			FILE *f = fopen(path, "rb");
+			if (!f) {
+				PARAM_ERROR("Cannot open snapshot file for reading its content: {}: {}\n", path, strerror(errno));
+				return false;
+			}
+			bool good = (fseek(f, 0, SEEK_END) == 0);
+			long size = (good ? ftell(f) : -1);
+			good = (size >= 0 && fseek(f, 0, SEEK_SET) == 0);
+			if (good) {
+				image.resize(size_t(size));
+				good = (fread(image.data(), 1, image.size(), f) == image.size());
+			}
+			fclose(f);
+			if (!good) {
+				PARAM_ERROR("Failed to read snapshot file '{}': {}\n", path, strerror(errno));
+				return false;
+			}
+		}
 
-			case STRING_PARAM: {
-				StringParam *ip = reinterpret_cast<StringParam *>(p);
-				ip->set_value(std::get<std::string>(datum.value), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
-			} break;
+		SnapshotFileHeader hdr;
+		if (image.size() < sizeof(hdr)) {
+			PARAM_ERROR("snapshot file '{}' is too small ({} bytes) to be a valid snapshot file\n", path, image.size());
+			return false;
+		}
+		memcpy(&hdr, image.data(), sizeof(hdr));
+		hdr.version = from_little_endian(hdr.version);
+		hdr.schema_fingerprint = from_little_endian(hdr.schema_fingerprint);
+		hdr.int_count = from_little_endian(hdr.int_count);
+		hdr.bool_count = from_little_endian(hdr.bool_count);
+		hdr.double_count = from_little_endian(hdr.double_count);
+		hdr.string_count = from_little_endian(hdr.string_count);
+		hdr.other_count = from_little_endian(hdr.other_count);
+		hdr.names_size = from_little_endian(hdr.names_size);
+		hdr.string_arena_size = from_little_endian(hdr.string_arena_size);
+		hdr.other_arena_size = from_little_endian(hdr.other_arena_size);
 
-			default: {
-				datum.param_ref = p;
-				p->set_value(std::get<std::string>(datum.value), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
-			} break;
+		if (0 != memcmp(hdr.magic, snapshot_file_magic, sizeof(snapshot_file_magic))) {
+			PARAM_ERROR("file '{}' is not a snapshot file: header magic mismatch\n", path);
+			return false;
+		}
+		if (hdr.version != snapshot_file_format_version) {
+			PARAM_ERROR("snapshot file '{}' has unsupported format version {}; we support version {}\n", path, hdr.version, snapshot_file_format_version);
+			return false;
+		}
+
+		const bool schema_matches = (hdr.schema_fingerprint == SchemaFingerprint(globals, locals));
+		if (!schema_matches) {
+			if (require_matching_schema) {
+				PARAM_ERROR("snapshot file '{}' was produced for a different parameter schema; the file will not be loaded.\n", path);
+				return false;
 			}
+			PARAM_WARN("snapshot file '{}' was produced for a different parameter schema: the parameters will be restored by name, while unknown parameters are skipped.\n", path);
+		}
+
+		const uint64_t total = uint64_t(hdr.int_count) + hdr.bool_count + hdr.double_count + hdr.string_count + hdr.other_count;
+		const uint64_t expected_size = sizeof(hdr) + uint64_t(hdr.int_count) * sizeof(int32_t) + uint64_t(hdr.double_count) * sizeof(double)
+			+ (uint64_t(hdr.string_count) + hdr.other_count) * sizeof(uint32_t) + uint64_t(hdr.other_count) * sizeof(uint16_t) + hdr.bool_count
+			+ hdr.names_size + hdr.string_arena_size + hdr.other_arena_size;
+		if (expected_size != image.size()) {
+			PARAM_ERROR("snapshot file '{}' is corrupt: its header announces {} bytes of content, while the file carries {} bytes\n", path, expected_size, image.size());
+			return false;
+		}
+
+		const uint8_t *pos = image.data() + sizeof(hdr);
+		std::vector<int32_t> int_values;
+		std::vector<double> double_values;
+		std::vector<uint32_t> string_ends;
+		std::vector<uint32_t> other_ends;
+		std::vector<uint16_t> other_types;
+		fetch_le_array(int_values, pos, hdr.int_count);
+		fetch_le_array(double_values, pos, hdr.double_count);
+		fetch_le_array(string_ends, pos, hdr.string_count);
+		fetch_le_array(other_ends, pos, hdr.other_count);
+		fetch_le_array(other_types, pos, hdr.other_count);
+		const uint8_t *bool_values = pos;
+		pos += hdr.bool_count;
+		const char *names = reinterpret_cast<const char *>(pos);
+		pos += hdr.names_size;
+		const char *string_arena = reinterpret_cast<const char *>(pos);
+		pos += hdr.string_arena_size;
+		const char *other_arena = reinterpret_cast<const char *>(pos);
+
+		// every name must be NUL-terminated, so we can use them in place.
+		if (uint64_t(std::count(names, names + hdr.names_size, '\0')) != total || (hdr.names_size > 0 && names[hdr.names_size - 1] != 0)
+			|| !valid_arena_ends(string_ends, hdr.string_arena_size) || !valid_arena_ends(other_ends, hdr.other_arena_size)) {
+			PARAM_ERROR("snapshot file '{}' is corrupt: invalid name or value string table\n", path);
+			return false;
+		}
+
+		// one pass over the file content: look up each parameter and assign its value.
+		size_t skipped = 0;
+		const char *name = names;
+		auto next_param = [&](ParamType type) -> ParamPtr {
+			ParamPtr p = find_snapshot_param(name, type, globals, locals);
+			name += strlen(name) + 1;
+			if (!p)
+				skipped++;
+			return p;
+		};
+
+		for (uint32_t i = 0; i < hdr.int_count; i++) {
+			if (ParamPtr p = next_param(INT_PARAM))
+				static_cast<IntParam *>(p)->set_value(int_values[i], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (uint32_t i = 0; i < hdr.bool_count; i++) {
+			if (ParamPtr p = next_param(BOOL_PARAM))
+				static_cast<BoolParam *>(p)->set_value(bool_values[i] != 0, PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+		}
+		for (uint32_t i = 0; i < hdr.double_count; i++) {
+			if (ParamPtr p = next_param(DOUBLE_PARAM))
+				static_cast<DoubleParam *>(p)->set_value(double_values[i], PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
 		}
+		for (uint32_t i = 0; i < hdr.string_count; i++) {
+			if (ParamPtr p = next_param(STRING_PARAM)) {
+				uint32_t start = (i == 0 ? 0 : string_ends[i - 1]);
+				static_cast<StringParam *>(p)->set_value(std::string(string_arena + start, string_ends[i] - start), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+			}
+		}
+		for (uint32_t i = 0; i < hdr.other_count; i++) {
+			if (ParamPtr p = next_param(ParamType(other_types[i]))) {
+				// these are stored in serialized form (see Param::raw_value_str()), so they go through their parser.
+				uint32_t start = (i == 0 ? 0 : other_ends[i - 1]);
+				p->set_value(std::string(other_arena + start, other_ends[i] - start), PARAM_VALUE_IS_SET_BY_SNAPSHOT_REWIND);
+			}
+		}
+
+		if (skipped > 0) {
+			PARAM_WARN("{} of the {} parameters stored in snapshot file '{}' are unknown (or of another type) and have been skipped.\n", skipped, total, path);
+		}
+		return true;
 	}
 
 	SnapshotSeries::~SnapshotSeries() {
+		if (Param::active_journal_ == this) {
+			Param::active_journal_ = nullptr;
+		}
 		for (SnapshotPtr snap : series) {
 			delete snap;
 		}
 		series.clear();
 	}
 
+	void SnapshotSeries::EnableJournaling(bool enable) {
+		if (!series.empty()) {
+			throw new std::logic_error(fmt::format("{}: snapshot journaling can only be switched on or off while the snapshot series is empty.", ParamUtils::GetApplicationName()));
+		}
+		if (enable) {
+			if (Param::active_journal_ != nullptr && Param::active_journal_ != this) {
+				throw new std::logic_error(fmt::format("{}: another snapshot series is already journaling the parameter changes.", ParamUtils::GetApplicationName()));
+			}
+			Param::active_journal_ = this;
+		} else if (Param::active_journal_ == this) {
+			Param::active_journal_ = nullptr;
+		}
+		journaling = enable;
+		journal_mark = 0;
+	}
+
+	bool SnapshotSeries::IsJournaling() const noexcept {
+		return journaling;
+	}
+
+	void SnapshotSeries::JournalParamChange(Param *p) {
+		if (series.empty())
+			return;
+		series.back()->undo_log.Record(p);
+	}
+
+	void SnapshotSeries::ReplayUndoLog(Snapshot &snapshot) {
+		// don't journal the rewind itself:
+		SnapshotSeries *journal = Param::active_journal_;
+		Param::active_journal_ = nullptr;
+
+		// A parameter may have been journaled more than once (see below); replaying in reverse order guarantees its oldest recorded value wins.
+		snapshot.undo_log.RestoreAll();
+		snapshot.undo_log.clear();
+
+		Param::active_journal_ = journal;
+	}
+
 	Snapshot &SnapshotSeries::TakeSnapshot(const char *name, ParamsVectorSet *globals, ParamsVectorSet *locals) {
-		SnapshotPtr snap = Snapshot::TakeSnapshot(name, globals, locals);
+		SnapshotPtr snap;
+		if (journaling) {
+			// a journaled snapshot is only a marker: the undo log collects the data as the parameters get changed.
+			snap = new Snapshot(name, series.empty() ? nullptr : series.back());
+			journal_mark = snap->version_stamp;
+		} else {
+			// every snapshot but the first one in the series is a delta snapshot.
+			snap = Snapshot::TakeSnapshot(name, globals, locals, series.empty() ? nullptr : series.back());
+		}
 		series.push_back(snap);
+		EnforceBudget();
 		return *snap;
 	}
 
 	void SnapshotSeries::RewindToSnapshot(Snapshot &snapshot) {
 		SnapshotPtr snap = &snapshot;
+		if (std::find(series.begin(), series.end(), snap) == series.end()) {
+			throw new std::logic_error(fmt::format("{}: cannot rewind to a snapshot which is not part of this snapshot series (any more).", ParamUtils::GetApplicationName()));
+		}
 
 		size_t i;
 		for (i = series.size(); i > 0; i--) {
 			SnapshotPtr si = series[i - 1];
+			if (journaling) {
+				// newest first: undo everything which happened since this snapshot point.
+				ReplayUndoLog(*si);
+			}
 			if (si == snap) {
-				Snapshot::ResetToSnapshot(*si);
+				if (!journaling) {
+					Snapshot::ResetToSnapshot(*si);
+				}
 				break;
 			}
 			series[i - 1] = nullptr;
 			delete si;
 		}
 		series.resize(i);
+
+		// Restart journaling from here: the state now equals the one at the snapshot point.
+		// Parameters restored above carry fresh versions, so they will be journaled again upon their next change.
+		journal_mark = Param::current_version();
+	}
+
+	void SnapshotSeries::SetBudget(size_t max_snapshot_count, size_t max_memory_bytes, SnapshotCompactionMode mode) {
+		max_snapshots = max_snapshot_count;
+		max_memory = max_memory_bytes;
+		compaction_mode = mode;
+		EnforceBudget();
+	}
+
+	size_t SnapshotSeries::size() const noexcept {
+		return series.size();
+	}
+
+	size_t SnapshotSeries::memory_usage() const noexcept {
+		size_t sum = series.capacity() * sizeof(SnapshotPtr);
+		for (SnapshotPtr snap : series) {
+			sum += snap->memory_usage();
+		}
+		return sum;
+	}
+
+	size_t SnapshotSeries::dropped_count() const noexcept {
+		return dropped;
+	}
+
+	void SnapshotSeries::EnforceBudget() {
+		if (max_snapshots == 0 && max_memory == 0)
+			return;
+
+		// the snapshot we drop: the oldest one, or the one following the base snapshot.
+		const size_t victim = (compaction_mode == SNAPSHOT_KEEP_BASE ? 1 : 0);
+		size_t usage = (max_memory != 0 ? memory_usage() : 0);
+		while (series.size() > victim + 1) {
+			const bool over_count = (max_snapshots != 0 && series.size() > max_snapshots);
+			const bool over_memory = (max_memory != 0 && usage > max_memory);
+			if (!over_count && !over_memory)
+				break;
+			DropSnapshot(victim);
+			if (max_memory != 0)
+				usage = memory_usage();
+		}
+	}
+
+	void SnapshotSeries::DropSnapshot(size_t index) {
+		DEBUG_ASSERT(index + 1 < series.size());
+		SnapshotPtr snap = series[index];
+		SnapshotPtr next = series[index + 1];
+
+		if (journaling) {
+			// The undo log carries the values at this snapshot point of the parameters changed before the next snapshot was taken.
+			// The previous snapshot needs those to rewind past this point, while they are simply obsolete when there's none.
+			if (index > 0) {
+				Snapshot *prev = series[index - 1];
+				prev->undo_log.MergeMissing(snap->undo_log);
+			}
+		} else {
+			// The next (delta) snapshot only recorded the parameters changed since this snapshot: the values recorded here
+			// for all other parameters still apply at the next snapshot point.
+			next->data.MergeMissing(snap->data);
+			next->data.shrink_to_fit();
+		}
+		next->parent = snap->parent;
+
+		series.erase(series.begin() + index);
+		delete snap;
+		dropped++;
+	}
+
+	bool SnapshotSeries::CollectValuesAt(const Snapshot &snapshot, SnapshotValues &dst, std::unordered_set<ParamPtr> &seen) const {
+		auto it = std::find(series.begin(), series.end(), &snapshot);
+		if (it == series.end())
+			return false;
+
+		if (journaling) {
+			// the first undo log entry for a parameter, from this snapshot point onwards, carries its value at the snapshot point.
+			for (; it != series.end(); ++it) {
+				dst.AppendChanged((*it)->undo_log, 0, seen);
+			}
+		} else {
+			// see Snapshot::ResetToSnapshot(): the first value recorded in the chain wins.
+			for (const Snapshot *snap = &snapshot; snap != nullptr; snap = snap->parent) {
+				dst.AppendChanged(snap->data, snapshot.version_stamp, seen);
+			}
+		}
+		return true;
+	}
+
+	bool SnapshotSeries::SaveSnapshot(const Snapshot &snapshot, const char *path, const ParamsVectorSet *globals, const ParamsVectorSet *locals) const {
+		// Collect the values as they were at the snapshot point for the parameters which have been changed since,
+		// while all other parameters still carry that value today.
+		SnapshotValues state;
+		std::unordered_set<ParamPtr> seen;
+		if (!CollectValuesAt(snapshot, state, seen)) {
+			PARAM_ERROR("Cannot produce snapshot file: {}: the snapshot '{}' is not part of this snapshot series.\n", path, snapshot.name);
+			return false;
+		}
+		Snapshot::RecordCurrentState(state, globals, locals, seen);
+
+		return state.WriteFile(path, Snapshot::SchemaFingerprint(globals, locals));
+	}
+
+	SnapshotDiff SnapshotSeries::DiffToCurrent(const Snapshot &snapshot) const {
+		SnapshotValues state;
+		std::unordered_set<ParamPtr> seen;
+		if (!CollectValuesAt(snapshot, state, seen)) {
+			throw new std::logic_error(fmt::format("{}: cannot diff snapshot '{}' as it is not part of this snapshot series.", ParamUtils::GetApplicationName(), snapshot.name));
+		}
+		std::unordered_map<ParamPtr, SnapshotValue> old_values;
+		state.ExportValues(old_values);
+
+		SnapshotDiff diff;
+		for (auto &i : old_values) {
+			// the parameter may have been changed back to its old value since: only report actual differences.
+			SnapshotValue current = SnapshotValues::CurrentValue(i.first);
+			if (current != i.second) {
+				diff.push_back({i.first, std::move(i.second), std::move(current)});
+			}
+		}
+		return diff;
+	}
+
+	SnapshotDiff SnapshotSeries::Diff(const Snapshot &from, const Snapshot &to) const {
+		SnapshotValues from_state;
+		SnapshotValues to_state;
+		std::unordered_set<ParamPtr> from_seen;
+		std::unordered_set<ParamPtr> to_seen;
+		if (!CollectValuesAt(from, from_state, from_seen) || !CollectValuesAt(to, to_state, to_seen)) {
+			throw new std::logic_error(fmt::format("{}: cannot diff snapshots '{}' and '{}' as they are not both part of this snapshot series.", ParamUtils::GetApplicationName(), from.name, to.name));
+		}
+		std::unordered_map<ParamPtr, SnapshotValue> from_values;
+		std::unordered_map<ParamPtr, SnapshotValue> to_values;
+		from_state.ExportValues(from_values);
+		to_state.ExportValues(to_values);
+
+		// Any parameter which differs between the two snapshot points has been changed since the older one, hence is listed in
+		// its collection. When a parameter isn't listed for a snapshot point, it has not been changed since: its current value applies.
+		const bool from_is_older = (from.version_stamp <= to.version_stamp);
+		const auto &candidates = (from_is_older ? from_values : to_values);
+
+		SnapshotDiff diff;
+		for (const auto &i : candidates) {
+			ParamPtr p = i.first;
+			auto f = from_values.find(p);
+			auto t = to_values.find(p);
+			SnapshotValue old_value = (f != from_values.end() ? f->second : SnapshotValues::CurrentValue(p));
+			SnapshotValue new_value = (t != to_values.end() ? t->second : SnapshotValues::CurrentValue(p));
+			if (old_value != new_value) {
+				diff.push_back({p, std::move(old_value), std::move(new_value)});
+			}
+		}
+		return diff;
 	}
 
 	void SnapshotSeries::PopSnapshot() {
@@ -191,8 +845,17 @@ namespace parameters {
 			i--;
 			SnapshotPtr si = series[i];
 			series.pop_back();
-			Snapshot::ResetToSnapshot(*si);
+			if (journaling) {
+				ReplayUndoLog(*si);
+			} else {
+				Snapshot::ResetToSnapshot(*si);
+			}
 			delete si;
+
+			// The parent's undo log remains valid as-is for the restored state. Moving the journal mark up to the current version
+			// means parameters which already have an entry in that log may be journaled once more upon their next change:
+			// that is harmless as the log is replayed in reverse order, where their oldest entry wins.
+			journal_mark = Param::current_version();
 		}
 	}
 
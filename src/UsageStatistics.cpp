@@ -0,0 +1,291 @@
+
+#include <parameters/parameters.h>
+
+#include "internal_helpers.hpp"
+#include "logchannel_helpers.hpp"
+#include "os_platform_helpers.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <mutex>
+
+
+namespace parameters {
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// UsageStatsDump
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	static const char usagestats_magic[4] = {'P', 'U', 'S', 'D'};
+	static const uint16_t usagestats_format_version = 1;
+
+	bool UsageStatsDump::Write(const char *path, const ParamsVectorSet &set) {
+		if (!path || !*path) {
+			PARAM_ERROR("Cannot produce usage statistics dump file: no file path specified\n");
+			return false;
+		}
+
+		std::vector<ParamPtr> params = set.as_list();
+		std::vector<UsageStatsRecord> records;
+		records.reserve(params.size());
+		std::string names;
+		std::string name;
+		for (ParamPtr p : params) {
+			name.clear();
+			append_normalized_param_name(name, p->name_str());
+
+			const auto &counts = p->access_counts();
+			uint8_t flags = 0;
+			if (p->is_init())
+				flags |= USAGESTATS_IS_INIT;
+			if (p->is_debug())
+				flags |= USAGESTATS_IS_DEBUG;
+			if (p->is_set_to_non_default_value())
+				flags |= USAGESTATS_IS_NON_DEFAULT;
+			if (p->has_faulted())
+				flags |= USAGESTATS_HAS_FAULTED;
+
+			UsageStatsRecord rec;
+			rec.name_hash = from_little_endian(fnv1a_hash(name));
+			rec.name_offset = from_little_endian(uint32_t(names.size()));
+			rec.type = from_little_endian(uint16_t(p->type()));
+			rec.set_mode = uint8_t(p->set_mode());
+			rec.flags = flags;
+			rec.reading = from_little_endian(counts.prev_sum_reading + counts.reading);
+			rec.writing = from_little_endian(counts.prev_sum_writing + counts.writing);
+			rec.changing = from_little_endian(counts.prev_sum_changing + counts.changing);
+			rec.faulting = from_little_endian(counts.prev_sum_faulting + counts.faulting);
+			records.push_back(rec);
+
+			names += name;
+			names += '\0';
+		}
+		DEBUG_ASSERT(names.size() <= UINT32_MAX);
+
+		UsageStatsDumpHeader hdr;
+		memcpy(hdr.magic, usagestats_magic, sizeof(usagestats_magic));
+		hdr.version = from_little_endian(usagestats_format_version);
+		hdr.record_size = from_little_endian(uint16_t(sizeof(UsageStatsRecord)));
+		hdr.record_count = from_little_endian(uint32_t(records.size()));
+		hdr.names_size = from_little_endian(uint32_t(names.size()));
+		hdr.schema_fingerprint = from_little_endian(Snapshot::SchemaFingerprint(&set, nullptr));
+		hdr.timestamp = from_little_endian(int64_t(std::time(nullptr)));
+
+		FILE *f = fopen(path, "wb");
+		if (!f) {
+			PARAM_ERROR("Cannot produce usage statistics dump file: {}: {}\n", path, strerror(errno));
+			return false;
+		}
+		bool good = (fwrite(&hdr, sizeof(hdr), 1, f) == 1);
+		if (good && !records.empty())
+			good = (fwrite(records.data(), sizeof(UsageStatsRecord), records.size(), f) == records.size());
+		if (good && !names.empty())
+			good = (fwrite(names.data(), 1, names.size(), f) == names.size());
+		if (fclose(f) != 0)
+			good = false;
+		if (!good) {
+			PARAM_ERROR("Failed to write usage statistics dump file '{}': {}\n", path, strerror(errno));
+		}
+		return good;
+	}
+
+	static std::string usagestats_atexit_path;
+	static const ParamsVectorSet *usagestats_atexit_set = nullptr;
+
+	static void write_usagestats_at_exit() {
+		if (usagestats_atexit_set != nullptr && !usagestats_atexit_path.empty()) {
+			UsageStatsDump::Write(usagestats_atexit_path.c_str(), *usagestats_atexit_set);
+		}
+	}
+
+	void UsageStatsDump::WriteAtExit(const char *path, const ParamsVectorSet &set) {
+		static std::once_flag registered;
+
+		usagestats_atexit_path = (path ? path : "");
+		usagestats_atexit_set = &set;
+		std::call_once(registered, []() {
+			std::atexit(write_usagestats_at_exit);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+	//
+	// UsageStatsAggregate
+	//
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UsageStatsAggregate::UsageStatsAggregate()
+		: runs_(0)
+		, failed_(0)
+	{}
+
+	bool UsageStatsAggregate::Merge(const char *path) {
+		errmsg_.clear();
+
+		FILE *f = (path && *path) ? fopen(path, "rb") : nullptr;
+		if (!f) {
+			errmsg_ = fmt::format("cannot open usage statistics dump file '{}': {}", path ? path : "", strerror(errno));
+			failed_++;
+			return false;
+		}
+		// load the entire file in one go: dumps are small, while we may have to process many thousands of them.
+		bool good = (fseek(f, 0, SEEK_END) == 0);
+		long size = (good ? ftell(f) : -1);
+		good = (size >= 0 && fseek(f, 0, SEEK_SET) == 0);
+		if (good) {
+			file_buffer_.resize(size_t(size));
+			good = (size == 0 || fread(file_buffer_.data(), 1, file_buffer_.size(), f) == file_buffer_.size());
+		}
+		fclose(f);
+		if (!good) {
+			errmsg_ = fmt::format("cannot read usage statistics dump file '{}': {}", path, strerror(errno));
+			failed_++;
+			return false;
+		}
+
+		const char *data = file_buffer_.data();
+		const size_t data_size = file_buffer_.size();
+
+		UsageStatsDumpHeader hdr;
+		if (data_size < sizeof(hdr)) {
+			errmsg_ = fmt::format("file '{}' is too small ({} bytes) to be a usage statistics dump file", path, data_size);
+			failed_++;
+			return false;
+		}
+		memcpy(&hdr, data, sizeof(hdr));
+		hdr.version = from_little_endian(hdr.version);
+		hdr.record_size = from_little_endian(hdr.record_size);
+		hdr.record_count = from_little_endian(hdr.record_count);
+		hdr.names_size = from_little_endian(hdr.names_size);
+
+		if (0 != memcmp(hdr.magic, usagestats_magic, sizeof(usagestats_magic))) {
+			errmsg_ = fmt::format("file '{}' is not a usage statistics dump file: header magic mismatch", path);
+		} else if (hdr.version != usagestats_format_version) {
+			errmsg_ = fmt::format("usage statistics dump file '{}' has unsupported format version {}; we support version {}", path, hdr.version, usagestats_format_version);
+		} else if (hdr.record_size < sizeof(UsageStatsRecord)) {
+			errmsg_ = fmt::format("usage statistics dump file '{}' carries records of unsupported size {}", path, hdr.record_size);
+		} else if (uint64_t(hdr.record_count) * hdr.record_size + hdr.names_size > data_size - sizeof(hdr)) {
+			errmsg_ = fmt::format("usage statistics dump file '{}' is truncated", path);
+		}
+		if (!errmsg_.empty()) {
+			failed_++;
+			return false;
+		}
+
+		const char *rec_data = data + sizeof(hdr);
+		const char *names = rec_data + size_t(hdr.record_count) * hdr.record_size;
+		for (uint32_t i = 0; i < hdr.record_count; i++) {
+			// newer format revisions may append fields to the record, which we skip.
+			UsageStatsRecord rec;
+			memcpy(&rec, rec_data + size_t(i) * hdr.record_size, sizeof(rec));
+			uint64_t hash = from_little_endian(rec.name_hash);
+			uint32_t name_offset = from_little_endian(rec.name_offset);
+			uint64_t reading = from_little_endian(rec.reading);
+			uint64_t writing = from_little_endian(rec.writing);
+			uint64_t changing = from_little_endian(rec.changing);
+			uint64_t faulting = from_little_endian(rec.faulting);
+
+			auto [l, inserted] = entries_.try_emplace(hash);
+			Entry &e = l->second;
+			if (inserted) {
+				if (name_offset < hdr.names_size)
+					e.name.assign(names + name_offset, strnlen(names + name_offset, hdr.names_size - name_offset));
+				e.type = ParamType(from_little_endian(rec.type));
+			}
+			e.flags |= rec.flags;
+			if (rec.set_mode < 32)
+				e.set_modes |= (1U << rec.set_mode);
+			e.runs++;
+			e.runs_reading += (reading > 0);
+			e.runs_writing += (writing > 0);
+			e.runs_changing += (changing > 0);
+			e.runs_faulting += (faulting > 0);
+			safe_add(e.reading, reading);
+			safe_add(e.writing, writing);
+			safe_add(e.changing, changing);
+			safe_add(e.faulting, faulting);
+		}
+		runs_++;
+		return true;
+	}
+
+	size_t UsageStatsAggregate::run_count() const noexcept {
+		return runs_;
+	}
+
+	size_t UsageStatsAggregate::failed_count() const noexcept {
+		return failed_;
+	}
+
+	const std::string &UsageStatsAggregate::error_message() const noexcept {
+		return errmsg_;
+	}
+
+	const std::unordered_map<uint64_t, UsageStatsAggregate::Entry> &UsageStatsAggregate::entries() const noexcept {
+		return entries_;
+	}
+
+	static void write_usagestats_entry(ReportWriter &dst, const UsageStatsAggregate::Entry &e) {
+		if (dst.IsJSONOutput()) {
+			size_t start = dst.BeginJSONRecord();
+			dst.Append("{\"record\":\"param_usage\",\"name\":");
+			dst.AppendJSONString(e.name);
+			dst.Format(",\"type\":\"{}\",\"init\":{},\"debug\":{},\"non_default\":{},\"runs\":{},\"runs_reading\":{},\"runs_writing\":{},\"runs_changing\":{},\"runs_faulting\":{},\"reads\":{},\"writes\":{},\"changes\":{},\"faults\":{}}}",
+				type_as_str(e.type), (e.flags & USAGESTATS_IS_INIT) != 0, (e.flags & USAGESTATS_IS_DEBUG) != 0, (e.flags & USAGESTATS_IS_NON_DEFAULT) != 0,
+				e.runs, e.runs_reading, e.runs_writing, e.runs_changing, e.runs_faulting, e.reading, e.writing, e.changing, e.faulting);
+			dst.EndJSONRecord(ReportWriter::PARAMREPORT_ITEM_LIST, start);
+			return;
+		}
+
+		size_t start = dst.BeginLine();
+		dst.Format("* {:.<60} {:10} {:8} {:8} {:8} {:8} {:12} {:12}\n", e.name, type_as_str(e.type), e.runs_reading, e.runs_writing, e.runs_changing, e.runs_faulting, e.reading, e.writing);
+		dst.EndLine(ReportWriter::PARAMREPORT_ITEM_LIST, start);
+	}
+
+	void UsageStatsAggregate::Report(ReportWriter &dst, bool report_unused_params, const char *section_title) const {
+		if (!section_title || !*section_title)
+			section_title = ParamUtils::GetApplicationName().c_str();
+
+		dst.WriteHeaderLine(fmt::format("{}: Combined Parameter Usage Statistics across {} runs", section_title, runs_), 1);
+
+		dst.WriteOther(ReportWriter::PARAMREPORT_TABLE_LEGENDA, "\n\n"
+			"(columns: the number of runs which read / wrote / changed the parameter / signaled a fault, followed by the total number of reads and writes across all runs)\n"
+			"\n\n");
+
+		std::vector<const Entry *> sorted;
+		sorted.reserve(entries_.size());
+		for (const auto &i : entries_) {
+			sorted.push_back(&i.second);
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) {
+			return a->name < b->name;
+		});
+
+		size_t used_count = 0;
+		for (const Entry *e : sorted) {
+			if (e->runs_reading > 0)
+				used_count++;
+		}
+
+		if (used_count > 0) {
+			dst.WriteHeaderLine("Used Parameters:", 2);
+			for (const Entry *e : sorted) {
+				if (e->runs_reading > 0)
+					write_usagestats_entry(dst, *e);
+			}
+		} else {
+			dst.WriteInfoParagraph("(No parameters were used in any of the runs.)\n");
+		}
+
+		if (report_unused_params && used_count < sorted.size()) {
+			dst.WriteHeaderLine("Unused Parameters:", 2);
+			for (const Entry *e : sorted) {
+				if (e->runs_reading == 0)
+					write_usagestats_entry(dst, *e);
+			}
+		}
+	}
+
+}	// namespace
@@ -20,7 +20,7 @@ namespace parameters {
 									const ParamsVectorSet &member_params,
 									SurplusParamsVector *surplus,
 									ParamSetBySourceType source_type,
-									ParamPtr source) {
+									ParamPtr source PARAM_CALL_SITE_PARAM) {
 		ConfigReader::line  line; // input line
 		bool anyerr = false;  // true if any error
 		bool foundit;         // found parameter
@@ -43,7 +43,7 @@ namespace parameters {
 					valptr++; // find end of blanks
 				} while (std::isspace(*valptr));
 			}
-			foundit = SetParam(nameptr, valptr, member_params, source_type, source);
+			foundit = SetParam(nameptr, valptr, member_params, source_type, source PARAM_CALL_SITE_ARG);
 
 			if (!foundit) {
 				if (surplus) {
@@ -163,11 +163,11 @@ namespace parameters {
 	bool ParamUtils::SetParam<int32_t>(
 			const char *name, const int32_t value,
 			const ParamsVectorSet &set,
-			ParamSetBySourceType source_type, ParamPtr source) {
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM) {
 				{
 					IntParam *param = FindParam<IntParam>(name, set);
 					if (param != nullptr) {
-						param->set_value(value, source_type, source);
+						param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 						return !param->has_faulted();
 					}
 				}
@@ -181,13 +181,13 @@ namespace parameters {
 
 						case BOOL_PARAM: {
 							BoolParam *bp = static_cast<BoolParam *>(param);
-							bp->set_value(value != 0, source_type, source);
+							bp->set_value(value != 0, source_type, source PARAM_CALL_SITE_ARG);
 							return !bp->has_faulted();
 						}
 
 						case DOUBLE_PARAM: {
 							DoubleParam *dp = static_cast<DoubleParam *>(param);
-							dp->set_value(value, source_type, source);
+							dp->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 							return !dp->has_faulted();
 						}
 
@@ -196,7 +196,7 @@ namespace parameters {
 						case CUSTOM_SET_PARAM:
 						default: {
 							std::string vs = fmt::format("{}", value);
-							param->set_value(vs, source_type, source);
+							param->set_value(vs, source_type, source PARAM_CALL_SITE_ARG);
 							return !param->has_faulted();
 						}
 
@@ -205,7 +205,7 @@ namespace parameters {
 							std::string vs = fmt::format("{}", value);
 							v.push_back(vs);
 							StringSetParam *p = static_cast<StringSetParam *>(param);
-							p->set_value(v, source_type, source);
+							p->set_value(v, source_type, source PARAM_CALL_SITE_ARG);
 							return !p->has_faulted();
 						}
 
@@ -213,7 +213,7 @@ namespace parameters {
 							std::vector<int32_t> iv;
 							iv.push_back(value);
 							IntSetParam *ivp = static_cast<IntSetParam *>(param);
-							ivp->set_value(iv, source_type, source);
+							ivp->set_value(iv, source_type, source PARAM_CALL_SITE_ARG);
 							return !ivp->has_faulted();
 						}
 
@@ -221,7 +221,7 @@ namespace parameters {
 							std::vector<bool> bv;
 							bv.push_back(value != 0);
 							BoolSetParam *bvp = static_cast<BoolSetParam *>(param);
-							bvp->set_value(bv, source_type, source);
+							bvp->set_value(bv, source_type, source PARAM_CALL_SITE_ARG);
 							return !bvp->has_faulted();
 						}
 
@@ -229,7 +229,7 @@ namespace parameters {
 							std::vector<double> dv;
 							dv.push_back(value);
 							DoubleSetParam *dvp = static_cast<DoubleSetParam *>(param);
-							dvp->set_value(dv, source_type, source);
+							dvp->set_value(dv, source_type, source PARAM_CALL_SITE_ARG);
 							return !dvp->has_faulted();
 						}
 						}
@@ -242,12 +242,12 @@ namespace parameters {
 	bool ParamUtils::SetParam<bool>(
 			const char* name, const bool value,
 			const ParamsVectorSet& set,
-			ParamSetBySourceType source_type, ParamPtr source
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM
 	) {
 		{
 			BoolParam* param = FindParam<BoolParam>(name, set);
 			if (param != nullptr) {
-				param->set_value(value, source_type, source);
+				param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 				return !param->has_faulted();
 			}
 		}
@@ -261,13 +261,13 @@ namespace parameters {
 
 				case INT_PARAM: {
 					IntParam *bp = static_cast<IntParam *>(param);
-					bp->set_value(value, source_type, source);
+					bp->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 					return !bp->has_faulted();
 				}
 
 				case DOUBLE_PARAM: {
 					DoubleParam *dp = static_cast<DoubleParam *>(param);
-					dp->set_value(value, source_type, source);
+					dp->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 					return !dp->has_faulted();
 				}
 
@@ -276,7 +276,7 @@ namespace parameters {
 				case CUSTOM_SET_PARAM:
 				default: {
 					const char *vs = (value ? "true" : "false");
-					param->set_value(vs, source_type, source);
+					param->set_value(vs, source_type, source PARAM_CALL_SITE_ARG);
 					return !param->has_faulted();
 				}
 
@@ -285,7 +285,7 @@ namespace parameters {
 					const char *vs = (value ? "true" : "false");
 					v.push_back(vs);
 					StringSetParam *p = static_cast<StringSetParam *>(param);
-					p->set_value(v, source_type, source);
+					p->set_value(v, source_type, source PARAM_CALL_SITE_ARG);
 					return !p->has_faulted();
 				}
 
@@ -293,7 +293,7 @@ namespace parameters {
 					std::vector<int32_t> iv;
 					iv.push_back(value);
 					IntSetParam *ivp = static_cast<IntSetParam *>(param);
-					ivp->set_value(iv, source_type, source);
+					ivp->set_value(iv, source_type, source PARAM_CALL_SITE_ARG);
 					return !ivp->has_faulted();
 				}
 
@@ -301,7 +301,7 @@ namespace parameters {
 					std::vector<bool> bv;
 					bv.push_back(value);
 					BoolSetParam *bvp = static_cast<BoolSetParam *>(param);
-					bvp->set_value(bv, source_type, source);
+					bvp->set_value(bv, source_type, source PARAM_CALL_SITE_ARG);
 					return !bvp->has_faulted();
 				}
 
@@ -309,7 +309,7 @@ namespace parameters {
 					std::vector<double> dv;
 					dv.push_back(value);
 					DoubleSetParam *dvp = static_cast<DoubleSetParam *>(param);
-					dvp->set_value(dv, source_type, source);
+					dvp->set_value(dv, source_type, source PARAM_CALL_SITE_ARG);
 					return !dvp->has_faulted();
 				}
 				}
@@ -322,12 +322,12 @@ namespace parameters {
 	bool ParamUtils::SetParam<double>(
 			const char* name, const double value,
 			const ParamsVectorSet& set,
-			ParamSetBySourceType source_type, ParamPtr source
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM
 	) {
 		{
 			DoubleParam* param = FindParam<DoubleParam>(name, set);
 			if (param != nullptr) {
-				param->set_value(value, source_type, source);
+				param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 				return !param->has_faulted();
 			}
 		}
@@ -343,7 +343,7 @@ namespace parameters {
 					BoolParam *bp = static_cast<BoolParam *>(param);
 					// reckon with the inaccuracy/noise inherent in IEEE754 calculus.
 					bool v = (value > -FLT_EPSILON && value < FLT_EPSILON);
-					bp->set_value(v, source_type, source);
+					bp->set_value(v, source_type, source PARAM_CALL_SITE_ARG);
 					return !bp->has_faulted();
 				}
 
@@ -352,7 +352,7 @@ namespace parameters {
 					auto v = round(value);
 					if (v < INT32_MIN || v > INT32_MAX)
 						return false;
-					dp->set_value(int32_t(v), source_type, source);
+					dp->set_value(int32_t(v), source_type, source PARAM_CALL_SITE_ARG);
 					return !dp->has_faulted();
 				}
 
@@ -361,7 +361,7 @@ namespace parameters {
 				case CUSTOM_SET_PARAM:
 				default: {
 					std::string vs = fmt::format("{}", value);
-					param->set_value(vs, source_type, source);
+					param->set_value(vs, source_type, source PARAM_CALL_SITE_ARG);
 					return !param->has_faulted();
 				}
 
@@ -370,7 +370,7 @@ namespace parameters {
 					std::string vs = fmt::format("{}", value);
 					v.push_back(vs);
 					StringSetParam *p = static_cast<StringSetParam *>(param);
-					p->set_value(v, source_type, source);
+					p->set_value(v, source_type, source PARAM_CALL_SITE_ARG);
 					return !p->has_faulted();
 				}
 
@@ -381,7 +381,7 @@ namespace parameters {
 						return false;
 					iv.push_back(v);
 					IntSetParam *ivp = static_cast<IntSetParam *>(param);
-					ivp->set_value(iv, source_type, source);
+					ivp->set_value(iv, source_type, source PARAM_CALL_SITE_ARG);
 					return !ivp->has_faulted();
 				}
 
@@ -391,7 +391,7 @@ namespace parameters {
 					bool v = (value > -FLT_EPSILON && value < FLT_EPSILON);
 					bv.push_back(v);
 					BoolSetParam *bvp = static_cast<BoolSetParam *>(param);
-					bvp->set_value(bv, source_type, source);
+					bvp->set_value(bv, source_type, source PARAM_CALL_SITE_ARG);
 					return !bvp->has_faulted();
 				}
 
@@ -399,7 +399,7 @@ namespace parameters {
 					std::vector<double> dv;
 					dv.push_back(value);
 					DoubleSetParam *dvp = static_cast<DoubleSetParam *>(param);
-					dvp->set_value(dv, source_type, source);
+					dvp->set_value(dv, source_type, source PARAM_CALL_SITE_ARG);
 					return !dvp->has_faulted();
 				}
 				}
@@ -411,19 +411,19 @@ namespace parameters {
 	bool ParamUtils::SetParam(
 			const char* name, const std::string &value,
 			const ParamsVectorSet& set,
-			ParamSetBySourceType source_type, ParamPtr source
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM
 	) {
 		{
 			StringParam* param = FindParam<StringParam>(name, set);
 			if (param != nullptr) {
-				param->set_value(value, source_type, source);
+				param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 				return !param->has_faulted();
 			}
 		}
 		{
 			Param* param = FindParam<Param>(name, set);
 			if (param != nullptr) {
-				param->set_value(value, source_type, source);
+				param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 				return !param->has_faulted();
 			}
 		}
@@ -433,11 +433,11 @@ namespace parameters {
 	bool ParamUtils::SetParam(
 			const char* name, const char *value,
 			const ParamsVectorSet& set,
-			ParamSetBySourceType source_type, ParamPtr source
+			ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM
 	) {
 		Param* param = FindParam(name, set, ANY_TYPE_PARAM);
 		if (param != nullptr) {
-			param->set_value(value, source_type, source);
+			param->set_value(value, source_type, source PARAM_CALL_SITE_ARG);
 			return !param->has_faulted();
 		}
 		return false;
@@ -460,10 +460,10 @@ namespace parameters {
 	bool ParamUtils::SetParam(
 		const char* name, const char* value,
 		ParamsVector& set,
-		ParamSetBySourceType source_type, ParamPtr source
+		ParamSetBySourceType source_type, ParamPtr source PARAM_CALL_SITE_PARAM
 	) {
 		ParamsVectorSet pvec({&set});
-		return SetParam(name, value, pvec, source_type, source);
+		return SetParam(name, value, pvec, source_type, source PARAM_CALL_SITE_ARG);
 	}
 
 }  // namespace
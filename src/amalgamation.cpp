@@ -9,10 +9,11 @@
 
 // -----------------------------------------------------------------------
 
-#include "./ParamArrayType.cpp"
 #include "./ParamArrayType_NumericBaseType.cpp"
 #include "./ParamArrayType_StringBaseType.cpp"
 #include "./ParamArrayType_UserDefinedClassBaseType.cpp"
+// the generic BasicVectorTypedParam code must come after all the explicit specializations above:
+#include "./ParamArrayType.cpp"
 
 #include "./ParamBaseType.cpp"
 #include "./ParamCoreType_Boolean.cpp"
@@ -24,11 +25,15 @@
 #include "./paramsAssist.cpp"
 #include "./ParamsVector.cpp"
 #include "./ParamsVectorSet.cpp"
+#include "./ParamEpochs.cpp"
 #include "./ReadWriteConfigFile.cpp"
 #include "./ReportFile.cpp"
 #include "./SetApplicationName.cpp"
 #include "./Snapshots.cpp"
+#include "./UsageStatistics.cpp"
+#include "./SharedStatsExport.cpp"
 #include "./Utilities.cpp"
+#include "./BinaryBlobFile.cpp"
 #include "./ConfigFile.cpp"
 #include "./CString.cpp"
 #include "./empty.cpp"
@@ -4,6 +4,10 @@
 #include <parameters/parameter_classes.h>
 #include <parameters/parameter_sets.h>
 
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <string>
 #include <type_traits>
 
 namespace parameters {
@@ -31,6 +35,89 @@ namespace parameters {
 			sum = SumT(0) - 1;
 	}
 
+	// Convert a value from little-endian storage order to native order (or vice versa: the operation is symmetrical).
+	// Used by the binary file formats (binary blob files, snapshot files), which are little-endian on disk.
+	template <class T>
+	static inline T from_little_endian(T v) {
+		if constexpr (std::endian::native == std::endian::little) {
+			return v;
+		} else {
+			uint8_t *p = reinterpret_cast<uint8_t *>(&v);
+			std::reverse(p, p + sizeof(T));
+			return v;
+		}
+	}
+
+	// The short type tags used in the (usage statistics) reports.
+	static inline const char *type_as_str(ParamType type) {
+		switch (type) {
+		case INT_PARAM:
+			return "[Integer]";
+		case BOOL_PARAM:
+			return "[Boolean]";
+		case DOUBLE_PARAM:
+			return "[Float]";
+		case STRING_PARAM:
+			return "[String]";
+
+		case INT_SET_PARAM:
+			return "[Arr:Int]";
+		case BOOL_SET_PARAM:
+			return "[Arr:Bool]";
+		case DOUBLE_SET_PARAM:
+			return "[Arr:Flt]";
+		case STRING_SET_PARAM:
+			return "[Arr:Str]";
+
+		case CUSTOM_PARAM:
+			return "[Custom]";
+		case CUSTOM_SET_PARAM:
+			return "[Arr:Cust]";
+
+		case ANY_TYPE_PARAM:
+			return "[ANY]";
+
+		default:
+			return "[???]";
+		}
+	}
+
+	// Parameter names are matched case-insensitive, while '-' and '_' are considered equal (see ParamHash):
+	// the normalized form is lowercase, using '_' only. Used by the binary file formats (snapshot files, usage statistics dumps).
+	static inline void append_normalized_param_name(std::string &dst, const char *name) {
+		for (const char *p = name; *p; p++) {
+			char c = char(std::tolower(static_cast<unsigned char>(*p)));
+			if (c == '-')
+				c = '_';
+			dst += c;
+		}
+	}
+
+	// FNV-1a 64-bit hash.
+	static inline uint64_t fnv1a_hash(const void *data, size_t length) {
+		const unsigned char *p = static_cast<const unsigned char *>(data);
+		uint64_t h = 14695981039346656037ULL;
+		for (size_t i = 0; i < length; i++) {
+			h ^= p[i];
+			h *= 1099511628211ULL;
+		}
+		return h;
+	}
+
+	static inline uint64_t fnv1a_hash(const std::string &str) {
+		return fnv1a_hash(str.data(), str.size());
+	}
+
+	// Parse a boolean value: a boolean word ([T]rue/[F]alse/[Y]es/[J]a/[N]o), a boolean symbol (+/-/./x) or a number (decimal, hex or octal, where
+	// any non-zero value equals TRUE), optionally surrounded by whitespace.
+	//
+	// Returns E_OK on success, ERANGE when the number does not fit the int32_t range, EINVAL otherwise.
+	// `endptr` points past the parsed value on success; on failure it points at the unparsable tail of a number or, when nothing
+	// sensible could be parsed at all, at the start of `str`.
+	//
+	// Shared by the BoolParam and BoolSetParam parsers.
+	int parse_boolean_value(const char *str, const char *&endptr, bool &value);
+
 	// --- end of helper functions set ---
 
 }   // namespace
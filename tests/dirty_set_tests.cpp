@@ -0,0 +1,151 @@
+
+// ParamsVector dirty sets: the parameters accessed since the last reset_access_counts(), as listed by touched_list().
+
+#include <parameters/parameters.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+	using namespace parameters;
+
+	static bool is_listed(const std::vector<ParamPtr> &list, const Param *p) {
+		return std::find(list.begin(), list.end(), p) != list.end();
+	}
+
+	TEST(DirtySetTest, FirstReadRegistersTheParameterOnce) {
+		ParamsVector vec("dirty_set_test");
+		IntParam a(1, "dirty_a", "int parameter", vec);
+		IntParam b(2, "dirty_b", "int parameter", vec);
+
+		EXPECT_TRUE(vec.tracks_all_accesses());
+		EXPECT_TRUE(vec.touched_list().empty());
+
+		EXPECT_EQ(a.value(), 1);
+		EXPECT_EQ(a.value(), 1);
+		const auto &list = vec.touched_list();
+		ASSERT_EQ(list.size(), 1u);
+		EXPECT_EQ(list[0], &a);
+		EXPECT_EQ(a.access_counts().reading, 2u);
+
+		// later accesses are picked up by the next touched_list() call, without duplicates.
+		b.set_value(3);
+		EXPECT_EQ(a.value(), 1);
+		EXPECT_EQ(vec.touched_list().size(), 2u);
+		EXPECT_TRUE(is_listed(vec.touched_list(), &b));
+	}
+
+	TEST(DirtySetTest, ResetClearsTheTouchedFlags) {
+		ParamsVector vec("dirty_reset_test");
+		IntParam a(1, "reset_a", "int parameter", vec);
+		IntParam b(2, "reset_b", "int parameter", vec);
+		BoolParam flag(false, "reset_flag", "bool parameter", vec);
+
+		a.value();
+		b.value();
+		flag.value();
+		EXPECT_EQ(vec.touched_list().size(), 3u);
+
+		vec.reset_access_counts();
+		EXPECT_TRUE(vec.touched_list().empty());
+		EXPECT_EQ(a.access_counts().reading, 0u);
+
+		// each parameter must register itself anew upon its first access in the new section.
+		b.value();
+		EXPECT_EQ(vec.touched_list().size(), 1u);
+		EXPECT_TRUE(is_listed(vec.touched_list(), &b));
+		a.value();
+		flag.value();
+		EXPECT_EQ(vec.touched_list().size(), 3u);
+		EXPECT_EQ(b.access_counts().reading, 1u);
+
+		vec.reset_access_counts(false);
+		EXPECT_TRUE(vec.touched_list().empty());
+		flag.value();
+		EXPECT_EQ(vec.touched_list().size(), 1u);
+	}
+
+	TEST(DirtySetTest, ConcurrentFirstReadsAreAllRegistered) {
+		const size_t thread_count = 8;
+		const size_t params_per_thread = 64;
+
+		ParamsVector vec("dirty_concurrency_test");
+		std::vector<std::unique_ptr<IntParam>> params;
+		for (size_t i = 0; i < thread_count * params_per_thread; i++) {
+			params.push_back(std::make_unique<IntParam>(int32_t(i), ("concurrent_" + std::to_string(i)).c_str(), "int parameter", vec));
+		}
+
+		for (int round = 0; round < 4; round++) {
+			// each thread reads its own share of the parameters (so the access counters themselves are not shared), while all of them
+			// push their first accesses onto the same dirty set at the same time.
+			std::atomic<bool> go{false};
+			std::vector<std::thread> readers;
+			for (size_t t = 0; t < thread_count; t++) {
+				readers.emplace_back([&, t]() {
+					while (!go.load(std::memory_order_acquire)) {
+						std::this_thread::yield();
+					}
+					for (size_t i = t; i < params.size(); i += thread_count) {
+						EXPECT_EQ(params[i]->value(), int32_t(i));
+					}
+				});
+			}
+			go.store(true, std::memory_order_release);
+			for (auto &r : readers) {
+				r.join();
+			}
+
+			const auto &list = vec.touched_list();
+			ASSERT_EQ(list.size(), params.size());
+			for (const auto &p : params) {
+				EXPECT_TRUE(is_listed(list, p.get()));
+			}
+
+			vec.reset_access_counts();
+			EXPECT_TRUE(vec.touched_list().empty());
+		}
+	}
+
+	TEST(DirtySetTest, RemoveUnlinksATouchedParameter) {
+		ParamsVector vec("dirty_remove_test");
+		IntParam a(1, "remove_a", "int parameter", vec);
+		IntParam b(2, "remove_b", "int parameter", vec);
+		IntParam c(3, "remove_c", "int parameter", vec);
+
+		// b ends up in the middle of the linked list, a in the already collected part, c at its head.
+		a.value();
+		EXPECT_EQ(vec.touched_list().size(), 1u);
+		b.value();
+		c.value();
+
+		vec.remove(&b);
+		EXPECT_FALSE(vec.tracks_all_accesses());
+		const auto &list = vec.touched_list();
+		EXPECT_EQ(list.size(), 2u);
+		EXPECT_TRUE(is_listed(list, &a));
+		EXPECT_FALSE(is_listed(list, &b));
+		EXPECT_TRUE(is_listed(list, &c));
+
+		// removing the head of the list.
+		vec.remove(&c);
+		EXPECT_EQ(vec.touched_list().size(), 1u);
+		EXPECT_TRUE(is_listed(vec.touched_list(), &a));
+
+		// the reset now has to visit every parameter, but it must still clear the dirty set.
+		vec.reset_access_counts();
+		EXPECT_TRUE(vec.touched_list().empty());
+		a.value();
+		EXPECT_EQ(vec.touched_list().size(), 1u);
+		EXPECT_EQ(a.access_counts().reading, 1u);
+		EXPECT_FALSE(vec.tracks_all_accesses());
+	}
+
+} // namespace
@@ -0,0 +1,187 @@
+
+// Snapshot files: Snapshot::SaveToFile() / Snapshot::RestoreFromFile() round-trips and the rejection of damaged files.
+
+#include <parameters/parameters.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+	using namespace parameters;
+
+	class SnapshotFileTest : public testing::Test {
+	protected:
+		SnapshotFileTest()
+			: vec("snapshot_file_test"),
+			count(7, "file_count", "int parameter", vec),
+			enabled(true, "file_enabled", "bool parameter", vec),
+			ratio(0.25, "file_ratio", "double parameter", vec),
+			label(std::string("stored label"), "file_label", "string parameter", vec),
+			path(testing::TempDir() + "parameters_snapshot_file_test.psnp") {
+			set.add(&vec);
+		}
+
+		~SnapshotFileTest() override {
+			std::remove(path.c_str());
+		}
+
+		void change_all() {
+			count.set_value(-1);
+			enabled.set_value(false);
+			ratio.set_value(9.5);
+			label.set_value("changed");
+		}
+
+		void expect_changed() {
+			EXPECT_EQ(count.value(), -1);
+			EXPECT_FALSE(enabled.value());
+			EXPECT_DOUBLE_EQ(ratio.value(), 9.5);
+			EXPECT_EQ(std::string(label.value()), "changed");
+		}
+
+		void expect_stored() {
+			EXPECT_EQ(count.value(), 7);
+			EXPECT_TRUE(enabled.value());
+			EXPECT_DOUBLE_EQ(ratio.value(), 0.25);
+			EXPECT_EQ(std::string(label.value()), "stored label");
+		}
+
+		std::vector<char> load_file() const {
+			std::vector<char> image;
+			FILE *f = fopen(path.c_str(), "rb");
+			if (!f)
+				return image;
+			char buf[4096];
+			size_t n;
+			while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+				image.insert(image.end(), buf, buf + n);
+			}
+			fclose(f);
+			return image;
+		}
+
+		void store_file(const std::vector<char> &image) const {
+			FILE *f = fopen(path.c_str(), "wb");
+			ASSERT_NE(f, nullptr);
+			ASSERT_EQ(fwrite(image.data(), 1, image.size(), f), image.size());
+			fclose(f);
+		}
+
+		// declared first, so the parameters are destroyed before the vector they are registered with.
+		ParamsVector vec;
+		ParamsVectorSet set;
+
+		IntParam count;
+		BoolParam enabled;
+		DoubleParam ratio;
+		StringParam label;
+
+		std::string path;
+	};
+
+	TEST_F(SnapshotFileTest, RoundTrip) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		change_all();
+		ASSERT_TRUE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr, true));
+		expect_stored();
+	}
+
+	TEST_F(SnapshotFileTest, HeaderIsWrittenAsDocumented) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		std::vector<char> image = load_file();
+		ASSERT_GE(image.size(), sizeof(SnapshotFileHeader));
+		EXPECT_EQ(std::string(image.data(), 4), "PSNP");
+		EXPECT_EQ(image[offsetof(SnapshotFileHeader, version)], 1);
+		EXPECT_EQ(image[offsetof(SnapshotFileHeader, version) + 1], 0);
+	}
+
+	TEST_F(SnapshotFileTest, RejectsMissingFile) {
+		change_all();
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_changed();
+	}
+
+	TEST_F(SnapshotFileTest, RejectsTruncatedFile) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		std::vector<char> image = load_file();
+		change_all();
+
+		// lacking the tail of the content section...
+		image.pop_back();
+		store_file(image);
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_changed();
+
+		// ... and lacking part of the header.
+		image.resize(sizeof(SnapshotFileHeader) - 1);
+		store_file(image);
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_changed();
+	}
+
+	TEST_F(SnapshotFileTest, RejectsBadMagic) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		std::vector<char> image = load_file();
+		image[0] = 'X';
+		store_file(image);
+		change_all();
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_changed();
+	}
+
+	TEST_F(SnapshotFileTest, RejectsUnterminatedNames) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		std::vector<char> image = load_file();
+
+		// the string parameter name is the last one in the name table: overwrite its NUL terminator so the table runs into the string arena.
+		const std::string name("file_label");
+		auto it = std::search(image.begin() + sizeof(SnapshotFileHeader), image.end(), name.begin(), name.end());
+		ASSERT_NE(it, image.end());
+		it += name.size();
+		ASSERT_EQ(*it, '\0');
+		*it = 'x';
+		store_file(image);
+
+		change_all();
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_changed();
+	}
+
+	TEST_F(SnapshotFileTest, FingerprintMismatch) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		std::vector<char> image = load_file();
+		image[offsetof(SnapshotFileHeader, schema_fingerprint)] ^= 0x5A;
+		store_file(image);
+
+		change_all();
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr, true));
+		expect_changed();
+
+		// without the strict schema check, the values are restored by name.
+		EXPECT_TRUE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr, false));
+		expect_stored();
+	}
+
+	TEST_F(SnapshotFileTest, RestoresByNameIntoADifferentSchema) {
+		ASSERT_TRUE(Snapshot::SaveToFile(path.c_str(), &set, nullptr));
+		change_all();
+
+		// an extra parameter changes the schema fingerprint; it's not in the file, so it must be left alone.
+		IntParam extra(3, "file_extra", "int parameter", vec);
+		extra.set_value(4);
+		EXPECT_FALSE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr, true));
+		EXPECT_TRUE(Snapshot::RestoreFromFile(path.c_str(), &set, nullptr));
+		expect_stored();
+		EXPECT_EQ(extra.value(), 4);
+
+		vec.remove(&extra);
+	}
+
+} // namespace
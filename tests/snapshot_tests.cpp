@@ -0,0 +1,259 @@
+
+// SnapshotSeries: take / rewind / pop, nested (delta) snapshots, budget compaction and the undo-log journaling mode.
+//
+// Every scenario is run twice: once with value-copying snapshots and once in journaling mode, as both must produce
+// the exact same parameter state.
+
+#include <parameters/parameters.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+
+namespace {
+
+	using namespace parameters;
+
+	class SnapshotSeriesTest : public testing::TestWithParam<bool> {
+	protected:
+		SnapshotSeriesTest()
+			: vec("snapshot_test"),
+			a(1, "snap_a", "int parameter", vec),
+			b(2, "snap_b", "int parameter", vec),
+			flag(false, "snap_flag", "bool parameter", vec),
+			ratio(0.5, "snap_ratio", "double parameter", vec),
+			label(std::string("initial"), "snap_label", "string parameter", vec) {
+			set.add(&vec);
+			series.EnableJournaling(GetParam());
+		}
+
+		~SnapshotSeriesTest() override {
+			// empty the series before the parameters go: the journal must be switched off explicitly.
+			while (series.size() > 0) {
+				series.PopSnapshot();
+			}
+			series.EnableJournaling(false);
+		}
+
+		Snapshot &take(const char *name) {
+			return series.TakeSnapshot(name, &set, nullptr);
+		}
+
+		// declared first, so the parameters are destroyed before the vector they are registered with.
+		ParamsVector vec;
+		ParamsVectorSet set;
+
+		IntParam a;
+		IntParam b;
+		BoolParam flag;
+		DoubleParam ratio;
+		StringParam label;
+
+		SnapshotSeries series;
+	};
+
+	TEST_P(SnapshotSeriesTest, RewindRestoresTheValuesAtTheSnapshotPoint) {
+		Snapshot &snap = take("start");
+
+		// multiple writes per parameter: the rewind must produce the oldest value, not the one before the last write.
+		a.set_value(10);
+		a.set_value(11);
+		flag.set_value(true);
+		ratio.set_value(1.25);
+		label.set_value("changed");
+		label.set_value("changed again");
+		EXPECT_EQ(a.value(), 11);
+
+		series.RewindToSnapshot(snap);
+		EXPECT_EQ(a.value(), 1);
+		EXPECT_EQ(b.value(), 2);
+		EXPECT_FALSE(flag.value());
+		EXPECT_DOUBLE_EQ(ratio.value(), 0.5);
+		EXPECT_EQ(std::string(label.value()), "initial");
+		EXPECT_EQ(series.size(), 1u);
+
+		// the snapshot remains a valid rewind target after the rewind.
+		a.set_value(20);
+		series.RewindToSnapshot(snap);
+		EXPECT_EQ(a.value(), 1);
+	}
+
+	TEST_P(SnapshotSeriesTest, PopRestoresAndRemovesTheLatestSnapshot) {
+		take("start");
+		b.set_value(-5);
+		series.PopSnapshot();
+		EXPECT_EQ(b.value(), 2);
+		EXPECT_EQ(series.size(), 0u);
+	}
+
+	TEST_P(SnapshotSeriesTest, NestedSnapshots) {
+		Snapshot &outer = take("outer");
+		a.set_value(10);
+		Snapshot &inner = take("inner");
+		a.set_value(20);
+		b.set_value(30);
+		label.set_value("inner");
+
+		series.RewindToSnapshot(inner);
+		EXPECT_EQ(a.value(), 10);
+		EXPECT_EQ(b.value(), 2);
+		EXPECT_EQ(std::string(label.value()), "initial");
+		EXPECT_EQ(series.size(), 2u);
+
+		// changes made after rewinding to the inner snapshot must be undone by the outer one as well.
+		b.set_value(40);
+		series.RewindToSnapshot(outer);
+		EXPECT_EQ(a.value(), 1);
+		EXPECT_EQ(b.value(), 2);
+		EXPECT_EQ(series.size(), 1u);
+	}
+
+	TEST_P(SnapshotSeriesTest, DiffToCurrentReportsTheChangedParameters) {
+		Snapshot &snap = take("start");
+		a.set_value(10);
+		// written, but set back to the original value: not a difference.
+		b.set_value(3);
+		b.set_value(2);
+
+		SnapshotDiff diff = series.DiffToCurrent(snap);
+		ASSERT_EQ(diff.size(), 1u);
+		EXPECT_EQ(diff[0].param, &a);
+		EXPECT_EQ(std::get<int32_t>(diff[0].old_value), 1);
+		EXPECT_EQ(std::get<int32_t>(diff[0].new_value), 10);
+	}
+
+	TEST_P(SnapshotSeriesTest, EvictOldestKeepsTheRecentSnapshotsValid) {
+		series.SetBudget(2, 0, SNAPSHOT_EVICT_OLDEST);
+
+		take("s1");
+		a.set_value(10);
+		Snapshot &s2 = take("s2");
+		a.set_value(20);
+		b.set_value(21);
+		Snapshot &s3 = take("s3");   // drops s1
+		EXPECT_EQ(series.size(), 2u);
+		EXPECT_EQ(series.dropped_count(), 1u);
+
+		a.set_value(30);
+		ratio.set_value(2.0);
+		series.RewindToSnapshot(s3);
+		EXPECT_EQ(a.value(), 20);
+		EXPECT_EQ(b.value(), 21);
+		EXPECT_DOUBLE_EQ(ratio.value(), 0.5);
+
+		series.RewindToSnapshot(s2);
+		EXPECT_EQ(a.value(), 10);
+		EXPECT_EQ(b.value(), 2);
+	}
+
+	TEST_P(SnapshotSeriesTest, KeepBaseMergesTheDroppedSnapshotIntoItsNeighbour) {
+		series.SetBudget(2, 0, SNAPSHOT_KEEP_BASE);
+
+		Snapshot &base = take("base");
+		a.set_value(10);
+		take("s2");
+		// b is first changed between s2 and s3: once s2 is dropped, its value at s2 must still be available to rewind to base.
+		a.set_value(20);
+		b.set_value(21);
+		flag.set_value(true);
+		Snapshot &s3 = take("s3");   // drops s2
+		EXPECT_EQ(series.size(), 2u);
+		EXPECT_EQ(series.dropped_count(), 1u);
+
+		a.set_value(30);
+		series.RewindToSnapshot(s3);
+		EXPECT_EQ(a.value(), 20);
+		EXPECT_EQ(b.value(), 21);
+		EXPECT_TRUE(flag.value());
+
+		series.RewindToSnapshot(base);
+		EXPECT_EQ(a.value(), 1);
+		EXPECT_EQ(b.value(), 2);
+		EXPECT_FALSE(flag.value());
+		EXPECT_EQ(series.size(), 1u);
+	}
+
+	TEST_P(SnapshotSeriesTest, BudgetAppliedToAnExistingSeries) {
+		take("s1");
+		a.set_value(10);
+		take("s2");
+		a.set_value(20);
+		take("s3");
+		a.set_value(30);
+		Snapshot &s4 = take("s4");
+
+		series.SetBudget(1, 0, SNAPSHOT_EVICT_OLDEST);
+		EXPECT_EQ(series.size(), 1u);
+		EXPECT_EQ(series.dropped_count(), 3u);
+
+		a.set_value(40);
+		series.RewindToSnapshot(s4);
+		EXPECT_EQ(a.value(), 30);
+	}
+
+	INSTANTIATE_TEST_SUITE_P(Snapshots, SnapshotSeriesTest, testing::Values(false, true),
+		[](const testing::TestParamInfo<bool> &info) {
+			return std::string(info.param ? "Journaling" : "Copying");
+		});
+
+	// A delta snapshot (only recording the parameters changed since its parent) must restore the exact same state
+	// as a full snapshot taken at the same point.
+	TEST(SnapshotTest, DeltaAndFullSnapshotsRestoreTheSameState) {
+		ParamsVector vec("snapshot_delta_test");
+		ParamsVectorSet set;
+		set.add(&vec);
+		IntParam a(1, "delta_a", "int parameter", vec);
+		IntParam b(2, "delta_b", "int parameter", vec);
+		DoubleParam ratio(0.5, "delta_ratio", "double parameter", vec);
+		StringParam label(std::string("initial"), "delta_label", "string parameter", vec);
+
+		SnapshotSeries delta_series;
+		SnapshotSeries full_series;
+
+		delta_series.TakeSnapshot("base", &set, nullptr);
+		a.set_value(10);
+		label.set_value("midway");
+		Snapshot &delta = delta_series.TakeSnapshot("delta", &set, nullptr);
+		// the first snapshot in a series is a full one.
+		Snapshot &full = full_series.TakeSnapshot("full", &set, nullptr);
+
+		a.set_value(20);
+		b.set_value(30);
+		ratio.set_value(4.0);
+		label.set_value("final");
+		delta_series.RewindToSnapshot(delta);
+		const int32_t delta_a = a.value();
+		const int32_t delta_b = b.value();
+		const double delta_ratio = ratio.value();
+		const std::string delta_label = label.value();
+
+		a.set_value(20);
+		b.set_value(30);
+		ratio.set_value(4.0);
+		label.set_value("final");
+		full_series.RewindToSnapshot(full);
+
+		EXPECT_EQ(delta_a, 10);
+		EXPECT_EQ(a.value(), delta_a);
+		EXPECT_EQ(b.value(), delta_b);
+		EXPECT_DOUBLE_EQ(ratio.value(), delta_ratio);
+		EXPECT_EQ(std::string(label.value()), delta_label);
+		EXPECT_EQ(delta_label, "midway");
+	}
+
+	// Each write must produce a fresh, strictly increasing version: snapshots depend on it to tell which parameters changed.
+	TEST(SnapshotTest, WritesBumpTheParameterVersion) {
+		ParamsVector vec("snapshot_version_test");
+		IntParam a(1, "version_a", "int parameter", vec);
+
+		const uint64_t before = a.version();
+		a.set_value(2);
+		const uint64_t after = a.version();
+		EXPECT_GT(after, before);
+		EXPECT_GE(Param::current_version(), after);
+		a.set_value(3);
+		EXPECT_GT(a.version(), after);
+	}
+
+} // namespace
@@ -0,0 +1,100 @@
+
+// Merge any number of binary parameter usage statistics dumps (see UsageStatsDump) into a combined usage report.
+//
+// usage: usagestats_aggregate [options] dumpfile...
+//
+//     -o <path>     write the report to the given file instead of stdout
+//     --json        produce a JSON report
+//     --jsonl       produce a JSON Lines report
+//     --used-only   do not list the parameters which were never read
+//     @<listfile>   read the dump file paths from the given file, one path per line; useful when merging many thousands of dumps
+
+#include <parameters/parameters.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(BUILD_MONOLITHIC)
+#define main	parameters_usagestats_aggregate_main
+#endif
+
+using namespace parameters;
+
+static void usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [-o <path>] [--json | --jsonl] [--used-only] [@<listfile>] dumpfile...\n", argv0);
+}
+
+static void merge_dump(UsageStatsAggregate &aggregate, const char *path) {
+	if (!aggregate.Merge(path)) {
+		fprintf(stderr, "%s\n", aggregate.error_message().c_str());
+	}
+}
+
+static bool merge_listed_dumps(UsageStatsAggregate &aggregate, const char *listfile) {
+	FILE *f = fopen(listfile, "r");
+	if (!f) {
+		fprintf(stderr, "cannot open dump list file '%s': %s\n", listfile, strerror(errno));
+		return false;
+	}
+	char line[4096];
+	while (fgets(line, sizeof(line), f)) {
+		size_t len = strlen(line);
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+			line[--len] = 0;
+		if (len == 0)
+			continue;
+		merge_dump(aggregate, line);
+	}
+	fclose(f);
+	return true;
+}
+
+int main(int argc, const char **argv) {
+	const char *output_path = "-";
+	ReportWriter::ReportType report_type = ReportWriter::PARAMREPORT_AS_MARKDOWN_REPORT;
+	bool report_unused_params = true;
+
+	UsageStatsAggregate aggregate;
+
+	for (int i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!strcmp(arg, "-o") && i + 1 < argc) {
+			output_path = argv[++i];
+		} else if (!strcmp(arg, "--json")) {
+			report_type = ReportWriter::PARAMREPORT_AS_JSON;
+		} else if (!strcmp(arg, "--jsonl")) {
+			report_type = ReportWriter::PARAMREPORT_AS_JSON_LINES;
+		} else if (!strcmp(arg, "--used-only")) {
+			report_unused_params = false;
+		} else if (!strcmp(arg, "-h") || !strcmp(arg, "--help")) {
+			usage(argv[0]);
+			return 0;
+		} else if (arg[0] == '@') {
+			if (!merge_listed_dumps(aggregate, arg + 1))
+				return 1;
+		} else if (arg[0] == '-' && arg[1] != 0) {
+			fprintf(stderr, "unknown option: %s\n", arg);
+			usage(argv[0]);
+			return 1;
+		} else {
+			merge_dump(aggregate, arg);
+		}
+	}
+
+	if (aggregate.run_count() == 0) {
+		fprintf(stderr, "no usage statistics dumps were merged.\n");
+		usage(argv[0]);
+		return 1;
+	}
+
+	{
+		StdioReportWriter writer(output_path, report_type);
+		writer.EnableAsyncOutput();
+		aggregate.Report(writer, report_unused_params, "usagestats_aggregate");
+		writer.Finalize();
+	}
+
+	fprintf(stderr, "merged %zu dumps; %zu dumps failed to load.\n", aggregate.run_count(), aggregate.failed_count());
+	return (aggregate.failed_count() > 0 ? 2 : 0);
+}